@@ -0,0 +1,777 @@
+// This Header
+#include "BlueprintGraphSnapshot.h"
+
+// Unreal
+#include "Async/ParallelFor.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraphSchema_K2.h"
+#include "Editor.h"
+#include "EditorValidatorSubsystem.h"
+#include "Engine/Blueprint.h"
+#include "HAL/IConsoleManager.h"
+#include "K2Node_BreakStruct.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Composite.h"
+#include "K2Node_Event.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Tunnel.h"
+#include "K2Node_Variable.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+namespace UE::Internal::BlueprintGraphSnapshotHelpers
+{
+	static bool IsHarmlessPureNode(UK2Node_CallFunction* CallNode)
+	{
+		if (!CallNode) return false;
+
+		UFunction* Func = CallNode->GetTargetFunction();
+		if (!Func)
+		{
+			return false;
+		}
+
+		if (Func->HasMetaData(TEXT("NativeBreakFunc")) || Func->HasMetaData(TEXT("NativeMakeFunc")))
+		{
+			return true;
+		}
+
+		UClass* OwnerClass = Func->GetOuterUClass();
+		if (!OwnerClass)
+		{
+			return false;
+		}
+
+		const FString OwnerName = OwnerClass->GetName();
+
+		if (OwnerName.Contains(TEXT("KismetMathLibrary")) ||
+			OwnerName.Contains(TEXT("KismetSystemLibrary")) ||
+			OwnerName.Contains(TEXT("KismetTextLibrary")) ||
+			OwnerName.Contains(TEXT("KismetStringTableLibrary")) ||
+			OwnerName.Contains(TEXT("KismetRenderingLibrary")) ||
+			OwnerName.Contains(TEXT("KismetMaterialLibrary")) ||
+			OwnerName.Contains(TEXT("KismetInternationalizationLibrary")) ||
+			OwnerName.Contains(TEXT("KismetInputLibrary")) ||
+			OwnerName.Contains(TEXT("KismetGuidLibrary")) ||
+			OwnerName.Contains(TEXT("KismetArrayLibrary")) ||
+			OwnerName.Contains(TEXT("GameplayStatics")) ||
+			OwnerName.Contains(TEXT("DataTableFunctionLibrary")) ||
+			OwnerName.Contains(TEXT("BlueprintSetLibrary")) ||
+			OwnerName.Contains(TEXT("BlueprintPlatformLibrary")) ||
+			OwnerName.Contains(TEXT("BlueprintPathsLibrary")) ||
+			OwnerName.Contains(TEXT("BlueprintMapLibrary")) ||
+			OwnerName.Contains(TEXT("BlueprintInstancedStructLibrary")) ||
+			OwnerName.Contains(TEXT("KismetNodeHelperLibrary")))
+		{
+			return true;
+		}
+
+		for (const TSubclassOf<UObject>& HarmlessClass : GetDefault<UCommonValidatorsDeveloperSettings>()->HarmlessPureNodeClasses)
+		{
+			if (HarmlessClass && OwnerClass->IsChildOf(HarmlessClass))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// OutBoundGraph is the graph a collapsed node or macro instance expands to
+	static void FillNode(UEdGraphNode* Node, FBlueprintGraphSnapshot::FNode& OutNode, UEdGraph*& OutBoundGraph)
+	{
+		OutBoundGraph = nullptr;
+
+		if (Node->IsA<UK2Node_BreakStruct>())
+		{
+			OutNode.Kind = EBlueprintGraphSnapshotNodeKind::BreakStruct;
+		}
+		else if (Node->IsA<UK2Node_Variable>())
+		{
+			OutNode.Kind = EBlueprintGraphSnapshotNodeKind::Variable;
+		}
+		else if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			OutNode.Kind = EBlueprintGraphSnapshotNodeKind::CallFunction;
+			OutNode.MemberName = CallNode->GetFunctionName();
+			OutNode.bIsPure = CallNode->IsNodePure();
+			OutNode.bIsHarmlessPure = OutNode.bIsPure && IsHarmlessPureNode(CallNode);
+		}
+		else if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+		{
+			OutNode.Kind = EBlueprintGraphSnapshotNodeKind::Event;
+			OutNode.MemberName = EventNode->EventReference.GetMemberName();
+			OutNode.bIsGhost = EventNode->IsAutomaticallyPlacedGhostNode();
+		}
+		else if (UK2Node_Composite* CompositeNode = Cast<UK2Node_Composite>(Node))
+		{
+			OutNode.Kind = EBlueprintGraphSnapshotNodeKind::Boundary;
+			OutBoundGraph = CompositeNode->BoundGraph;
+		}
+		else if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+		{
+			OutNode.Kind = EBlueprintGraphSnapshotNodeKind::Boundary;
+			OutBoundGraph = MacroNode->GetMacroGraph();
+		}
+		else if (UK2Node_Tunnel* TunnelNode = Cast<UK2Node_Tunnel>(Node); TunnelNode && TunnelNode->GetClass() == UK2Node_Tunnel::StaticClass())
+		{
+			// The entry tunnel outputs the graph's inputs
+			OutNode.Kind = TunnelNode->bCanHaveOutputs ? EBlueprintGraphSnapshotNodeKind::TunnelEntry : EBlueprintGraphSnapshotNodeKind::TunnelExit;
+		}
+	}
+
+	// Nodes reachable through exec links from any node without an exec input (events, function entries and tunnels)
+	static void CollectReachableExecNodes(const FBlueprintGraphSnapshot& Snapshot, TBitArray<>& OutReachable)
+	{
+		OutReachable.Init(false, Snapshot.Nodes.Num());
+
+		TArray<int32> Queue;
+		for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+		{
+			if (Snapshot.Nodes[NodeIndex].ExecInputPin == INDEX_NONE)
+			{
+				OutReachable[NodeIndex] = true;
+				Queue.Add(NodeIndex);
+			}
+		}
+
+		while (Queue.Num() > 0)
+		{
+			const int32 Current = Queue.Pop();
+			const FBlueprintGraphSnapshot::FNode& Node = Snapshot.Nodes[Current];
+			for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+			{
+				const FBlueprintGraphSnapshot::FPin& Pin = Snapshot.Pins[PinIndex];
+				if (!Pin.bIsExec || !Pin.bIsOutput)
+				{
+					continue;
+				}
+
+				for (int32 LinkedPin : Snapshot.GetLinks(PinIndex))
+				{
+					const int32 Next = Snapshot.Pins[LinkedPin].Node;
+					if (!OutReachable[Next])
+					{
+						OutReachable[Next] = true;
+						Queue.Add(Next);
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Follows data links to the exec nodes that evaluate them. Collapsed and macro graphs are expanded inline when
+	 * compiled, so an input feeding several exec nodes inside one re-evaluates whatever is connected to it outside.
+	 * Those graphs are summarized per input pin the first time they are reached, and the summary is reused for every instance.
+	 */
+	class FDataFlowAnalyzer
+	{
+	public:
+		struct FFlow
+		{
+			// Exec nodes evaluating the data directly
+			TArray<int32> Sinks;
+			// Exec nodes inside boundaries, counted per boundary input
+			int32 NumHiddenSinks = 0;
+			// Boundary nodes holding the hidden sinks
+			TArray<int32> SinkBoundaries;
+			// Tunnel exit pins the data reaches without an exec node in between
+			TArray<FName> ExitPins;
+
+			int32 GetNumSinks() const { return Sinks.Num() + NumHiddenSinks; }
+		};
+
+		explicit FDataFlowAnalyzer(const FBlueprintGraphSnapshot& InSnapshot)
+			: Snapshot(InSnapshot)
+		{
+			CollectReachableExecNodes(Snapshot, Reachable);
+		}
+
+		// Walks from the data output pins. With bFollowOwnerExits, data leaving a collapsed graph continues from its collapsed node.
+		void Walk(TConstArrayView<int32> StartPins, bool bFollowOwnerExits, FFlow& OutFlow)
+		{
+			TArray<int32, TInlineAllocator<32>> Queue;
+			TSet<int32, DefaultKeyFuncs<int32>, TInlineSetAllocator<32>> VisitedPins;
+			TSet<int32, DefaultKeyFuncs<int32>, TInlineSetAllocator<32>> VisitedNodes;
+
+			auto EnqueueLinks = [this, &Queue](int32 OutputPin)
+			{
+				if (OutputPin != INDEX_NONE)
+				{
+					Queue.Append(Snapshot.GetLinks(OutputPin));
+				}
+			};
+
+			for (int32 StartPin : StartPins)
+			{
+				EnqueueLinks(StartPin);
+			}
+
+			while (Queue.Num() > 0)
+			{
+				const int32 InputPin = Queue.Pop();
+
+				bool bAlreadyVisited = false;
+				VisitedPins.Add(InputPin, &bAlreadyVisited);
+				if (bAlreadyVisited)
+				{
+					continue;
+				}
+
+				const FBlueprintGraphSnapshot::FPin& Pin = Snapshot.Pins[InputPin];
+				const int32 NodeIndex = Pin.Node;
+				const FBlueprintGraphSnapshot::FNode& Node = Snapshot.Nodes[NodeIndex];
+
+				if (Node.Kind == EBlueprintGraphSnapshotNodeKind::Boundary)
+				{
+					if (Node.BoundaryGraph == INDEX_NONE || !Reachable[NodeIndex])
+					{
+						continue;
+					}
+
+					// Used right away, GetSummary may add to the map on the next call
+					const FInputSummary* Summary = GetSummary(Node.BoundaryGraph).Find(Pin.Name);
+					if (!Summary)
+					{
+						continue;
+					}
+
+					if (Summary->NumSinks > 0)
+					{
+						OutFlow.NumHiddenSinks += Summary->NumSinks;
+						OutFlow.SinkBoundaries.AddUnique(NodeIndex);
+					}
+
+					for (const FName& OutputName : Summary->PassThroughOutputs)
+					{
+						EnqueueLinks(Snapshot.FindPin(NodeIndex, OutputName, /*bIsOutput=*/true));
+					}
+					continue;
+				}
+
+				if (Node.Kind == EBlueprintGraphSnapshotNodeKind::TunnelExit)
+				{
+					OutFlow.ExitPins.AddUnique(Pin.Name);
+
+					const int32 OwnerNode = Snapshot.Graphs[Node.Graph].OwnerNode;
+					if (bFollowOwnerExits && OwnerNode != INDEX_NONE)
+					{
+						EnqueueLinks(Snapshot.FindPin(OwnerNode, Pin.Name, /*bIsOutput=*/true));
+					}
+					continue;
+				}
+
+				bAlreadyVisited = false;
+				VisitedNodes.Add(NodeIndex, &bAlreadyVisited);
+				if (bAlreadyVisited)
+				{
+					continue;
+				}
+
+				if (Snapshot.IsPinLinked(Node.ExecInputPin))
+				{
+					if (Reachable[NodeIndex])
+					{
+						OutFlow.Sinks.AddUnique(NodeIndex);
+					}
+					continue;
+				}
+
+				// Pure node, everything it feeds evaluates it again
+				for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+				{
+					const FBlueprintGraphSnapshot::FPin& OutputPin = Snapshot.Pins[PinIndex];
+					if (OutputPin.bIsOutput && !OutputPin.bIsExec)
+					{
+						EnqueueLinks(PinIndex);
+					}
+				}
+			}
+		}
+
+		bool IsReachable(int32 NodeIndex) const { return Reachable[NodeIndex]; }
+
+	private:
+		struct FInputSummary
+		{
+			// Exec nodes inside evaluating this input, capped at two since only "more than one" matters
+			int32 NumSinks = 0;
+			TArray<FName> PassThroughOutputs;
+		};
+
+		using FGraphSummary = TMap<FName, FInputSummary>;
+
+		const FGraphSummary& GetSummary(int32 GraphIndex)
+		{
+			if (const FGraphSummary* Existing = Summaries.Find(GraphIndex))
+			{
+				return *Existing;
+			}
+
+			// A macro can't instance itself, this only guards against broken assets
+			static const FGraphSummary Empty;
+			bool bAlreadyInProgress = false;
+			GraphsInProgress.Add(GraphIndex, &bAlreadyInProgress);
+			if (bAlreadyInProgress)
+			{
+				return Empty;
+			}
+
+			FGraphSummary Summary;
+			const int32 EntryNode = Snapshot.Graphs[GraphIndex].EntryNode;
+			if (EntryNode != INDEX_NONE)
+			{
+				for (int32 PinIndex = Snapshot.Nodes[EntryNode].FirstPin; PinIndex < Snapshot.Nodes[EntryNode].FirstPin + Snapshot.Nodes[EntryNode].NumPins; ++PinIndex)
+				{
+					const FBlueprintGraphSnapshot::FPin& EntryPin = Snapshot.Pins[PinIndex];
+					if (!EntryPin.bIsOutput || EntryPin.bIsExec)
+					{
+						continue;
+					}
+
+					FFlow Flow;
+					Walk(MakeArrayView(&PinIndex, 1), /*bFollowOwnerExits=*/false, Flow);
+
+					FInputSummary& InputSummary = Summary.Add(EntryPin.Name);
+					InputSummary.NumSinks = FMath::Min(Flow.GetNumSinks(), 2);
+					InputSummary.PassThroughOutputs = MoveTemp(Flow.ExitPins);
+				}
+			}
+
+			GraphsInProgress.Remove(GraphIndex);
+			return Summaries.Add(GraphIndex, MoveTemp(Summary));
+		}
+
+		const FBlueprintGraphSnapshot& Snapshot;
+		TBitArray<> Reachable;
+		TMap<int32, FGraphSummary> Summaries;
+		TSet<int32> GraphsInProgress;
+	};
+
+	// Data output pins of a node
+	static void CollectDataOutputs(const FBlueprintGraphSnapshot& Snapshot, int32 NodeIndex, TArray<int32, TInlineAllocator<8>>& OutPins)
+	{
+		const FBlueprintGraphSnapshot::FNode& Node = Snapshot.Nodes[NodeIndex];
+		for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+		{
+			if (Snapshot.Pins[PinIndex].bIsOutput && !Snapshot.Pins[PinIndex].bIsExec)
+			{
+				OutPins.Add(PinIndex);
+			}
+		}
+	}
+
+	static FAutoConsoleCommand AnalyzeBlueprintGraphsCommand(
+		TEXT("CommonValidators.AnalyzeBlueprintGraphs"),
+		TEXT("Validates all blueprints under a path, with the pure node, empty tick and blocking load checks run in parallel up front. Usage: CommonValidators.AnalyzeBlueprintGraphs [/Game/Path]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			TArray<UBlueprint*> Blueprints;
+			UCommonValidatorsStatics::LoadBlueprintsUnderPath(Args.Num() > 0 ? Args[0] : TEXT("/Game"), Blueprints);
+
+			const int32 NumIssues = FBlueprintGraphAnalysis::ValidateBlueprintsInParallel(Blueprints);
+			UE_LOG(LogCommonValidators, Display, TEXT("Found %d issues across %d blueprints."), NumIssues, Blueprints.Num());
+		}));
+} // namespace UE::Internal::BlueprintGraphSnapshotHelpers
+
+
+void FBlueprintGraphAnalysis::BuildSnapshot(UBlueprint* Blueprint, FBlueprintGraphSnapshot& OutSnapshot, FBlueprintGraphSnapshotSource* OutSource)
+{
+	TArray<UEdGraph*> AllGraphs;
+	if (Blueprint)
+	{
+		AllGraphs.Append(Blueprint->FunctionGraphs);
+		AllGraphs.Append(Blueprint->UbergraphPages);
+		AllGraphs.Append(Blueprint->MacroGraphs);
+	}
+
+	BuildSnapshot(Blueprint, AllGraphs, OutSnapshot, OutSource);
+}
+
+void FBlueprintGraphAnalysis::BuildSnapshot(UBlueprint* Blueprint, TConstArrayView<UEdGraph*> InGraphs, FBlueprintGraphSnapshot& OutSnapshot, FBlueprintGraphSnapshotSource* OutSource)
+{
+	check(IsInGameThread());
+
+	OutSnapshot = FBlueprintGraphSnapshot();
+	if (OutSource)
+	{
+		*OutSource = FBlueprintGraphSnapshotSource();
+		OutSource->Blueprint = Blueprint;
+	}
+
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	// First pass assigns node and pin indices, second pass resolves links and boundary graphs through them.
+	// Graphs behind collapsed nodes and macro instances are appended to the list as they are found.
+	TMap<const UEdGraphPin*, int32> PinIndices;
+	TArray<const UEdGraphPin*> SourcePins;
+	TArray<UEdGraph*> Graphs(InGraphs);
+	TMap<const UEdGraph*, int32> GraphIndices;
+	TArray<UEdGraph*> NodeBoundGraphs;
+
+	for (int32 GraphListIndex = 0; GraphListIndex < Graphs.Num(); ++GraphListIndex)
+	{
+		UEdGraph* Graph = Graphs[GraphListIndex];
+		if (!Graph || GraphIndices.Contains(Graph))
+		{
+			continue;
+		}
+
+		GraphIndices.Add(Graph, OutSnapshot.Graphs.Num());
+		FBlueprintGraphSnapshot::FGraph& SnapshotGraph = OutSnapshot.Graphs.AddDefaulted_GetRef();
+		SnapshotGraph.FirstNode = OutSnapshot.Nodes.Num();
+		SnapshotGraph.bIsUbergraph = Blueprint->UbergraphPages.Contains(Graph);
+		SnapshotGraph.bIsExternal = Graph->GetTypedOuter<UBlueprint>() != Blueprint;
+		if (OutSource)
+		{
+			OutSource->Graphs.Add(Graph);
+		}
+
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+
+			const int32 NodeIndex = OutSnapshot.Nodes.Num();
+			FBlueprintGraphSnapshot::FNode& SnapshotNode = OutSnapshot.Nodes.AddDefaulted_GetRef();
+			SnapshotNode.Graph = OutSnapshot.Graphs.Num() - 1;
+			SnapshotNode.FirstPin = OutSnapshot.Pins.Num();
+
+			UEdGraph* BoundGraph = nullptr;
+			UE::Internal::BlueprintGraphSnapshotHelpers::FillNode(Node, SnapshotNode, BoundGraph);
+			NodeBoundGraphs.Add(BoundGraph);
+			if (BoundGraph)
+			{
+				Graphs.AddUnique(BoundGraph);
+			}
+
+			if (SnapshotNode.Kind == EBlueprintGraphSnapshotNodeKind::TunnelEntry)
+			{
+				SnapshotGraph.EntryNode = NodeIndex;
+			}
+			else if (SnapshotNode.Kind == EBlueprintGraphSnapshotNodeKind::TunnelExit)
+			{
+				SnapshotGraph.ExitNode = NodeIndex;
+			}
+
+			if (OutSource)
+			{
+				OutSource->Nodes.Add(Node);
+			}
+
+			// Node->Pins also holds the sub pins of split struct pins, so their links are kept as well
+			for (const UEdGraphPin* Pin : Node->Pins)
+			{
+				const int32 PinIndex = OutSnapshot.Pins.Num();
+				FBlueprintGraphSnapshot::FPin& SnapshotPin = OutSnapshot.Pins.AddDefaulted_GetRef();
+				SnapshotPin.Node = NodeIndex;
+				SnapshotPin.Name = Pin->PinName;
+				SnapshotPin.bIsOutput = Pin->Direction == EGPD_Output;
+				SnapshotPin.bIsExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+
+				if (SnapshotPin.bIsExec)
+				{
+					if (!SnapshotPin.bIsOutput && Pin->PinName == UEdGraphSchema_K2::PN_Execute)
+					{
+						SnapshotNode.ExecInputPin = PinIndex;
+					}
+					else if (SnapshotPin.bIsOutput && Pin->PinName == UEdGraphSchema_K2::PN_Then)
+					{
+						SnapshotNode.ThenPin = PinIndex;
+					}
+				}
+
+				PinIndices.Add(Pin, PinIndex);
+				SourcePins.Add(Pin);
+			}
+
+			SnapshotNode.NumPins = OutSnapshot.Pins.Num() - SnapshotNode.FirstPin;
+		}
+
+		SnapshotGraph.NumNodes = OutSnapshot.Nodes.Num() - SnapshotGraph.FirstNode;
+	}
+
+	for (int32 NodeIndex = 0; NodeIndex < NodeBoundGraphs.Num(); ++NodeIndex)
+	{
+		if (const int32* BoundGraphIndex = GraphIndices.Find(NodeBoundGraphs[NodeIndex]))
+		{
+			OutSnapshot.Nodes[NodeIndex].BoundaryGraph = *BoundGraphIndex;
+
+			// A collapsed graph belongs to its one collapsed node, macro graphs are shared by all their instances
+			if (NodeBoundGraphs[NodeIndex]->GetOuter()->IsA<UK2Node_Composite>())
+			{
+				OutSnapshot.Graphs[*BoundGraphIndex].OwnerNode = NodeIndex;
+			}
+		}
+	}
+
+	for (int32 PinIndex = 0; PinIndex < SourcePins.Num(); ++PinIndex)
+	{
+		FBlueprintGraphSnapshot::FPin& SnapshotPin = OutSnapshot.Pins[PinIndex];
+		SnapshotPin.FirstLink = OutSnapshot.Links.Num();
+
+		for (const UEdGraphPin* LinkedPin : SourcePins[PinIndex]->LinkedTo)
+		{
+			if (const int32* LinkedIndex = PinIndices.Find(LinkedPin))
+			{
+				OutSnapshot.Links.Add(*LinkedIndex);
+			}
+		}
+
+		SnapshotPin.NumLinks = OutSnapshot.Links.Num() - SnapshotPin.FirstLink;
+	}
+}
+
+void FBlueprintGraphAnalysis::FindMultiExecPureNodes(const FBlueprintGraphSnapshot& Snapshot, TArray<int32>& OutNodes)
+{
+	using namespace UE::Internal::BlueprintGraphSnapshotHelpers;
+
+	// One analyzer for the whole blueprint, so every collapsed and macro graph is summarized once
+	FDataFlowAnalyzer Analyzer(Snapshot);
+	TArray<int32, TInlineAllocator<8>> OutputPins;
+
+	for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+	{
+		const FBlueprintGraphSnapshot::FNode& Node = Snapshot.Nodes[NodeIndex];
+		if (Node.Kind != EBlueprintGraphSnapshotNodeKind::CallFunction || !Node.bIsPure || Node.bIsHarmlessPure || Snapshot.Graphs[Node.Graph].bIsExternal)
+		{
+			continue;
+		}
+
+		OutputPins.Reset();
+		CollectDataOutputs(Snapshot, NodeIndex, OutputPins);
+
+		FDataFlowAnalyzer::FFlow Flow;
+		Analyzer.Walk(OutputPins, /*bFollowOwnerExits=*/true, Flow);
+		if (Flow.GetNumSinks() > 1)
+		{
+			OutNodes.Add(NodeIndex);
+		}
+	}
+}
+
+void FBlueprintGraphAnalysis::FindExecSinks(const FBlueprintGraphSnapshot& Snapshot, int32 PureNode, TArray<int32>& OutSinks, int32* OutNumEvaluations)
+{
+	using namespace UE::Internal::BlueprintGraphSnapshotHelpers;
+
+	FDataFlowAnalyzer Analyzer(Snapshot);
+	TArray<int32, TInlineAllocator<8>> OutputPins;
+	CollectDataOutputs(Snapshot, PureNode, OutputPins);
+
+	FDataFlowAnalyzer::FFlow Flow;
+	Analyzer.Walk(OutputPins, /*bFollowOwnerExits=*/true, Flow);
+
+	OutSinks.Append(Flow.Sinks);
+	for (int32 Boundary : Flow.SinkBoundaries)
+	{
+		OutSinks.AddUnique(Boundary);
+	}
+
+	if (OutNumEvaluations)
+	{
+		*OutNumEvaluations = Flow.GetNumSinks();
+	}
+}
+
+void FBlueprintGraphAnalysis::FindEmptyTicks(const FBlueprintGraphSnapshot& Snapshot, TArray<int32>& OutNodes)
+{
+	static const FName EventTickName(TEXT("ReceiveTick"));
+
+	for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+	{
+		const FBlueprintGraphSnapshot::FNode& Node = Snapshot.Nodes[NodeIndex];
+		if (Node.Kind != EBlueprintGraphSnapshotNodeKind::Event || Node.MemberName != EventTickName || !Snapshot.Graphs[Node.Graph].bIsUbergraph)
+		{
+			continue;
+		}
+
+		// Ghost nodes aren't real nodes
+		if (!Node.bIsGhost && Node.ThenPin != INDEX_NONE && !Snapshot.IsPinLinked(Node.ThenPin))
+		{
+			OutNodes.Add(NodeIndex);
+		}
+	}
+}
+
+void FBlueprintGraphAnalysis::FindBlockingLoads(const FBlueprintGraphSnapshot& Snapshot, TArray<int32>& OutNodes)
+{
+	for (int32 NodeIndex = 0; NodeIndex < Snapshot.Nodes.Num(); ++NodeIndex)
+	{
+		const FBlueprintGraphSnapshot::FNode& Node = Snapshot.Nodes[NodeIndex];
+		// Loads inside another asset's macro are reported on that asset
+		if (Node.Kind == EBlueprintGraphSnapshotNodeKind::CallFunction && IsBlockingLoadFunction(Node.MemberName) && !Snapshot.Graphs[Node.Graph].bIsExternal)
+		{
+			OutNodes.Add(NodeIndex);
+		}
+	}
+}
+
+bool FBlueprintGraphAnalysis::IsBlockingLoadFunction(FName FunctionName)
+{
+	static const FName LoadAssetBlockingFunctionName(TEXT("LoadAsset_Blocking"));
+	static const FName LoadClassAssetBlockingFunctionName(TEXT("LoadClassAsset_Blocking"));
+
+	return FunctionName == LoadAssetBlockingFunctionName || FunctionName == LoadClassAssetBlockingFunctionName;
+}
+
+void FBlueprintGraphAnalysis::AnalyzeInParallel(TConstArrayView<FBlueprintGraphSnapshot> Snapshots, TArray<FResult>& OutResults)
+{
+	OutResults.Reset();
+	OutResults.SetNum(Snapshots.Num());
+
+	// Each task only reads its own snapshot and writes its own result slot
+	ParallelFor(Snapshots.Num(), [Snapshots, &OutResults](int32 Index)
+	{
+		const FBlueprintGraphSnapshot& Snapshot = Snapshots[Index];
+		FResult& Result = OutResults[Index];
+
+		FindMultiExecPureNodes(Snapshot, Result.MultiExecPureNodes);
+		FindEmptyTicks(Snapshot, Result.EmptyTicks);
+		FindBlockingLoads(Snapshot, Result.BlockingLoads);
+	});
+}
+
+int32 FBlueprintGraphAnalysis::ValidateBlueprintsInParallel(const TArray<UBlueprint*>& Blueprints)
+{
+	check(IsInGameThread());
+
+	UEditorValidatorSubsystem* ValidatorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UEditorValidatorSubsystem>() : nullptr;
+	if (!ValidatorSubsystem)
+	{
+		return 0;
+	}
+
+	// The validators find every blueprint of the pass already analyzed
+	FBlueprintGraphAnalysisCache& Cache = FBlueprintGraphAnalysisCache::Get();
+	Cache.Prepare(Blueprints);
+	ON_SCOPE_EXIT
+	{
+		Cache.Reset();
+	};
+
+	TArray<FAssetData> Assets;
+	Assets.Reserve(Blueprints.Num());
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		if (Blueprint)
+		{
+			Assets.Emplace(Blueprint);
+		}
+	}
+
+	FValidateAssetsSettings Settings;
+	Settings.bSkipExcludedDirectories = true;
+	Settings.bShowIfNoFailures = false;
+	Settings.ValidationUsecase = EDataValidationUsecase::Manual;
+
+	FValidateAssetsResults Results;
+	ValidatorSubsystem->ValidateAssetsWithSettings(Assets, Settings, Results);
+	return Results.NumInvalid + Results.NumWarnings;
+}
+
+
+FBlueprintGraphAnalysisCache& FBlueprintGraphAnalysisCache::Get()
+{
+	static FBlueprintGraphAnalysisCache Instance;
+	return Instance;
+}
+
+void FBlueprintGraphAnalysisCache::Initialize()
+{
+	OnPreAssetValidationHandle = FEditorDelegates::OnPreAssetValidation.AddRaw(this, &FBlueprintGraphAnalysisCache::OnPreAssetValidation);
+	OnPostAssetValidationHandle = FEditorDelegates::OnPostAssetValidation.AddRaw(this, &FBlueprintGraphAnalysisCache::OnPostAssetValidation);
+}
+
+void FBlueprintGraphAnalysisCache::Shutdown()
+{
+	FEditorDelegates::OnPreAssetValidation.Remove(OnPreAssetValidationHandle);
+	FEditorDelegates::OnPostAssetValidation.Remove(OnPostAssetValidationHandle);
+
+	Reset();
+}
+
+void FBlueprintGraphAnalysisCache::Prepare(const TArray<UBlueprint*>& Blueprints)
+{
+	check(IsInGameThread());
+
+	TArray<UBlueprint*> NewBlueprints;
+	TArray<FBlueprintGraphSnapshot> Snapshots;
+	TArray<FBlueprintGraphSnapshotSource> Sources;
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		if (Blueprint && !Entries.Contains(Blueprint) && !NewBlueprints.Contains(Blueprint))
+		{
+			NewBlueprints.Add(Blueprint);
+			FBlueprintGraphAnalysis::BuildSnapshot(Blueprint, Snapshots.AddDefaulted_GetRef(), &Sources.AddDefaulted_GetRef());
+		}
+	}
+
+	TArray<FBlueprintGraphAnalysis::FResult> Results;
+	FBlueprintGraphAnalysis::AnalyzeInParallel(Snapshots, Results);
+
+	for (int32 Index = 0; Index < NewBlueprints.Num(); ++Index)
+	{
+		TSharedRef<FEntry> Entry = MakeShared<FEntry>();
+		Entry->Snapshot = MoveTemp(Snapshots[Index]);
+		Entry->Source = MoveTemp(Sources[Index]);
+		Entry->Result = MoveTemp(Results[Index]);
+		Entries.Add(NewBlueprints[Index], Entry);
+	}
+
+	bIsPrepared = true;
+}
+
+TSharedRef<const FBlueprintGraphAnalysisCache::FEntry> FBlueprintGraphAnalysisCache::FindOrAnalyze(UBlueprint* Blueprint)
+{
+	check(IsInGameThread());
+
+	if (const TSharedRef<const FEntry>* Found = Entries.Find(Blueprint))
+	{
+		return *Found;
+	}
+
+	TSharedRef<FEntry> Entry = MakeShared<FEntry>();
+	FBlueprintGraphAnalysis::BuildSnapshot(Blueprint, Entry->Snapshot, &Entry->Source);
+	FBlueprintGraphAnalysis::FindMultiExecPureNodes(Entry->Snapshot, Entry->Result.MultiExecPureNodes);
+	FBlueprintGraphAnalysis::FindEmptyTicks(Entry->Snapshot, Entry->Result.EmptyTicks);
+	FBlueprintGraphAnalysis::FindBlockingLoads(Entry->Snapshot, Entry->Result.BlockingLoads);
+
+	// Outside a pass the blueprint may be edited before the next validation, don't keep anything
+	if (ValidationPassDepth > 0 || bIsPrepared)
+	{
+		Entries.Add(Blueprint, Entry);
+	}
+
+	return Entry;
+}
+
+void FBlueprintGraphAnalysisCache::Reset()
+{
+	Entries.Reset();
+	bIsPrepared = false;
+}
+
+void FBlueprintGraphAnalysisCache::OnPreAssetValidation()
+{
+	++ValidationPassDepth;
+}
+
+void FBlueprintGraphAnalysisCache::OnPostAssetValidation()
+{
+	if (ValidationPassDepth > 0 && --ValidationPassDepth == 0)
+	{
+		Reset();
+	}
+}
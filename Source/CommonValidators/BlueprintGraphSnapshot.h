@@ -0,0 +1,222 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+
+enum class EBlueprintGraphSnapshotNodeKind : uint8
+{
+	Other,
+	CallFunction,
+	Event,
+	Variable,
+	BreakStruct,
+	// Input and output tunnels of a collapsed or macro graph
+	TunnelEntry,
+	TunnelExit,
+	// Collapsed node or macro instance, expanded inline when compiled
+	Boundary,
+};
+
+/**
+ * Immutable, UObject-free copy of a blueprint's function and event graphs.
+ *
+ * Nodes, pins and links are stored in flat arrays and reference each other by index, so once built on the
+ * game thread a snapshot can be analyzed on any thread while the editor keeps running.
+ * Indices map back to the source objects through FBlueprintGraphSnapshotSource, which never leaves the game thread.
+ */
+struct COMMONVALIDATORS_API FBlueprintGraphSnapshot
+{
+	struct FGraph
+	{
+		int32 FirstNode = 0;
+		int32 NumNodes = 0;
+
+		// Tunnel nodes of collapsed and macro graphs, INDEX_NONE otherwise
+		int32 EntryNode = INDEX_NONE;
+		int32 ExitNode = INDEX_NONE;
+		// Collapsed node this graph is bound to. Macros have any number of instances and no owner.
+		int32 OwnerNode = INDEX_NONE;
+
+		bool bIsUbergraph = false;
+		// Macro graph from another asset, only pulled in to see through its instances
+		bool bIsExternal = false;
+	};
+
+	struct FNode
+	{
+		int32 Graph = INDEX_NONE;
+		int32 FirstPin = 0;
+		int32 NumPins = 0;
+
+		// Execute input and Then output, INDEX_NONE when the node has none
+		int32 ExecInputPin = INDEX_NONE;
+		int32 ThenPin = INDEX_NONE;
+
+		// Target function of calls, event function of events
+		FName MemberName;
+
+		// Graph a Boundary node expands to
+		int32 BoundaryGraph = INDEX_NONE;
+
+		EBlueprintGraphSnapshotNodeKind Kind = EBlueprintGraphSnapshotNodeKind::Other;
+		bool bIsPure = false;
+		// Pure call into a library we trust to be cheap, or a native make/break
+		bool bIsHarmlessPure = false;
+		bool bIsGhost = false;
+	};
+
+	struct FPin
+	{
+		int32 Node = INDEX_NONE;
+		int32 FirstLink = 0;
+		int32 NumLinks = 0;
+		// Matches boundary node pins to the tunnel pins of their graph
+		FName Name;
+		bool bIsOutput = false;
+		bool bIsExec = false;
+	};
+
+	TArray<FGraph> Graphs;
+	TArray<FNode> Nodes;
+	TArray<FPin> Pins;
+
+	// Pin indices each pin is linked to, sliced by FPin::FirstLink/NumLinks
+	TArray<int32> Links;
+
+	TConstArrayView<int32> GetLinks(int32 PinIndex) const
+	{
+		const FPin& Pin = Pins[PinIndex];
+		return TConstArrayView<int32>(Links.GetData() + Pin.FirstLink, Pin.NumLinks);
+	}
+
+	TConstArrayView<FPin> GetPins(int32 NodeIndex) const
+	{
+		const FNode& Node = Nodes[NodeIndex];
+		return TConstArrayView<FPin>(Pins.GetData() + Node.FirstPin, Node.NumPins);
+	}
+
+	bool IsPinLinked(int32 PinIndex) const { return PinIndex != INDEX_NONE && Pins[PinIndex].NumLinks > 0; }
+
+	int32 FindPin(int32 NodeIndex, FName PinName, bool bIsOutput) const
+	{
+		const FNode& Node = Nodes[NodeIndex];
+		for (int32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+		{
+			if (Pins[PinIndex].Name == PinName && Pins[PinIndex].bIsOutput == bIsOutput)
+			{
+				return PinIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+};
+
+// Objects the snapshot indices were taken from. Game thread only.
+struct COMMONVALIDATORS_API FBlueprintGraphSnapshotSource
+{
+	TWeakObjectPtr<UBlueprint> Blueprint;
+	TArray<TWeakObjectPtr<UEdGraph>> Graphs;
+	TArray<TWeakObjectPtr<UEdGraphNode>> Nodes;
+
+	int32 FindNodeIndex(const UEdGraphNode* Node) const
+	{
+		return Nodes.IndexOfByPredicate([Node](const TWeakObjectPtr<UEdGraphNode>& Candidate) { return Candidate.Get() == Node; });
+	}
+};
+
+/**
+ * Graph analyses shared by the pure node, empty tick and blocking load validators.
+ * Everything but the Build and Validate functions only reads snapshots and is safe to call from worker threads.
+ */
+class COMMONVALIDATORS_API FBlueprintGraphAnalysis
+{
+public:
+	struct FResult
+	{
+		TArray<int32> MultiExecPureNodes;
+		TArray<int32> EmptyTicks;
+		TArray<int32> BlockingLoads;
+	};
+
+	// Snapshots the blueprint's function, event and macro graphs. Game thread only.
+	// Graphs of collapsed nodes and of instanced macros are always added after the requested graphs.
+	static void BuildSnapshot(UBlueprint* Blueprint, FBlueprintGraphSnapshot& OutSnapshot, FBlueprintGraphSnapshotSource* OutSource = nullptr);
+
+	// Snapshots only the given graphs. Game thread only.
+	static void BuildSnapshot(UBlueprint* Blueprint, TConstArrayView<UEdGraph*> InGraphs, FBlueprintGraphSnapshot& OutSnapshot, FBlueprintGraphSnapshotSource* OutSource = nullptr);
+
+	/**
+	 * Every non-harmless pure call that is evaluated by more than one reachable exec node.
+	 * Data flow is followed into collapsed and macro graphs and back out of them, each of those graphs is summarized once per call.
+	 */
+	static void FindMultiExecPureNodes(const FBlueprintGraphSnapshot& Snapshot, TArray<int32>& OutNodes);
+
+	// The reachable exec nodes that each evaluate the pure node, in no particular order.
+	// A collapsed node or macro instance stands in for the sinks inside it.
+	// OutNumEvaluations counts those inner sinks too, so it can be above the number of sinks.
+	static void FindExecSinks(const FBlueprintGraphSnapshot& Snapshot, int32 PureNode, TArray<int32>& OutSinks, int32* OutNumEvaluations = nullptr);
+
+	// Tick events in event graphs with nothing connected to them
+	static void FindEmptyTicks(const FBlueprintGraphSnapshot& Snapshot, TArray<int32>& OutNodes);
+
+	static void FindBlockingLoads(const FBlueprintGraphSnapshot& Snapshot, TArray<int32>& OutNodes);
+
+	static bool IsBlockingLoadFunction(FName FunctionName);
+
+	// Runs every analysis over every snapshot, spread across worker threads
+	static void AnalyzeInParallel(TConstArrayView<FBlueprintGraphSnapshot> Snapshots, TArray<FResult>& OutResults);
+
+	/**
+	 * Validates the blueprints through the validator subsystem, with their graphs snapshotted up front on the game thread
+	 * and analyzed in parallel, so the graph validators only pick up the results.
+	 * @return The number of blueprints that failed validation plus the number of warnings
+	 */
+	static int32 ValidateBlueprintsInParallel(const TArray<UBlueprint*>& Blueprints);
+};
+
+/**
+ * Snapshot and analysis of each blueprint for the current validation pass, shared by the pure node, empty tick and
+ * blocking load validators so a blueprint is snapshotted and analyzed once per pass instead of once per validator.
+ * Entries live from FEditorDelegates::OnPreAssetValidation to OnPostAssetValidation, outside a pass nothing is kept.
+ * Game thread only.
+ */
+class COMMONVALIDATORS_API FBlueprintGraphAnalysisCache
+{
+public:
+	struct FEntry
+	{
+		FBlueprintGraphSnapshot Snapshot;
+		FBlueprintGraphSnapshotSource Source;
+		FBlueprintGraphAnalysis::FResult Result;
+	};
+
+	static FBlueprintGraphAnalysisCache& Get();
+
+	// Called on module startup/shutdown
+	void Initialize();
+	void Shutdown();
+
+	// Snapshots the blueprints and analyzes them on worker threads. Kept until Reset or the end of the next validation pass.
+	void Prepare(const TArray<UBlueprint*>& Blueprints);
+
+	// Prepared or cached entry of the blueprint, otherwise snapshots and analyzes it now
+	TSharedRef<const FEntry> FindOrAnalyze(UBlueprint* Blueprint);
+
+	void Reset();
+
+private:
+	void OnPreAssetValidation();
+	void OnPostAssetValidation();
+
+	TMap<TObjectKey<UBlueprint>, TSharedRef<const FEntry>> Entries;
+	// Validation passes can nest, entries are dropped when the outermost one ends
+	int32 ValidationPassDepth = 0;
+	bool bIsPrepared = false;
+
+	FDelegateHandle OnPreAssetValidationHandle;
+	FDelegateHandle OnPostAssetValidationHandle;
+};
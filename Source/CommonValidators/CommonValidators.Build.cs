@@ -6,16 +6,25 @@ public class CommonValidators : ModuleRules
 	{
 		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
 
+		// Headers sit next to the sources, expose them to the other modules of the plugin
+		PublicIncludePaths.Add(ModuleDirectory);
+
 		PrivateDependencyModuleNames.AddRange(new string[] {
 			"Core",
 			"CoreUObject",
 			"Engine",
+			"EngineSettings",
 			"DataValidation",
 			"BlueprintGraph",
 			"DeveloperSettings",
 			"Kismet",
 			"UnrealEd",
-			"AssetManagerEditor"
+			"AssetManagerEditor",
+			"Json",
+			"JsonUtilities",
+			"UMG",
+			"UMGEditor",
+			"Projects"
 		});
 	}
 }
@@ -1,3 +1,32 @@
 #include "Modules/ModuleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "BlueprintGraphSnapshot.h"
+#include "CommonValidatorsDependencySnapshot.h"
+#include "CommonValidatorsStatics.h"
 
-IMPLEMENT_MODULE(FDefaultModuleImpl, CommonValidators)
+DEFINE_LOG_CATEGORY(LogCommonValidators);
+
+class FCommonValidatorsModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		FCommonValidatorsDependencySnapshot::Get().Initialize();
+		FBlueprintGraphAnalysisCache::Get().Initialize();
+
+		// The Niagara system validator links Niagara, so it lives in its own module that projects without Niagara never load
+		const TSharedPtr<IPlugin> NiagaraPlugin = IPluginManager::Get().FindPlugin(TEXT("Niagara"));
+		if (NiagaraPlugin.IsValid() && NiagaraPlugin->IsEnabled())
+		{
+			FModuleManager::Get().LoadModule(TEXT("CommonValidatorsNiagara"));
+		}
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FBlueprintGraphAnalysisCache::Get().Shutdown();
+		FCommonValidatorsDependencySnapshot::Get().Shutdown();
+	}
+};
+
+IMPLEMENT_MODULE(FCommonValidatorsModule, CommonValidators)
@@ -0,0 +1,213 @@
+// This Header
+#include "CommonValidatorsChangeSetCommandlet.h"
+
+// Unreal
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Editor.h"
+#include "EditorValidatorSubsystem.h"
+#include "Misc/DataValidation.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+#include "EditorValidator_HeavyReference.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(CommonValidatorsChangeSetCommandlet)
+
+namespace UE::Internal::ChangeSetCommandletHelpers
+{
+	// Referencers are loaded one by one, unload them every this many so large change sets don't run out of memory
+	static constexpr int32 GarbageCollectionInterval = 64;
+} // namespace UE::Internal::ChangeSetCommandletHelpers
+
+
+UCommonValidatorsChangeSetCommandlet::UCommonValidatorsChangeSetCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UCommonValidatorsChangeSetCommandlet::Main(const FString& Params)
+{
+	using namespace UE::Internal::ChangeSetCommandletHelpers;
+
+	FString ChangedPackagesFile;
+	if (!FParse::Value(*Params, TEXT("ChangedPackages="), ChangedPackagesFile))
+	{
+		UE_LOG(LogCommonValidators, Error, TEXT("Usage: -run=CommonValidatorsChangeSet -ChangedPackages=<File>"));
+		return 1;
+	}
+
+	TArray<FName> ChangedPackages;
+	if (!ReadChangedPackages(ChangedPackagesFile, ChangedPackages))
+	{
+		UE_LOG(LogCommonValidators, Error, TEXT("Could not read changed packages from %s"), *ChangedPackagesFile);
+		return 1;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(/*bSynchronousSearch=*/true);
+
+	// Only a handful of closures get sized, a whole project pass would cost more than it saves
+	UCommonValidatorsDeveloperSettings* DevSettings = GetMutableDefault<UCommonValidatorsDeveloperSettings>();
+	const bool bPrecomputeClosures = DevSettings->bPrecomputeHeavyReferenceClosuresInCommandlets;
+	DevSettings->bPrecomputeHeavyReferenceClosuresInCommandlets = false;
+	ON_SCOPE_EXIT
+	{
+		DevSettings->bPrecomputeHeavyReferenceClosuresInCommandlets = bPrecomputeClosures;
+	};
+
+	TArray<FAssetData> ChangedAssets;
+	for (const FName& PackageName : ChangedPackages)
+	{
+		const FAssetData AssetData = UCommonValidatorsStatics::GetMainAssetData(AssetRegistry, PackageName);
+		if (AssetData.IsValid())
+		{
+			ChangedAssets.Add(AssetData);
+		}
+	}
+
+	UE_LOG(LogCommonValidators, Display, TEXT("Validating %d changed assets"), ChangedAssets.Num());
+
+	UEditorValidatorSubsystem* ValidatorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UEditorValidatorSubsystem>() : nullptr;
+	if (!ValidatorSubsystem)
+	{
+		UE_LOG(LogCommonValidators, Error, TEXT("Editor validator subsystem is not available"));
+		return 1;
+	}
+
+	FValidateAssetsSettings Settings;
+	Settings.bSkipExcludedDirectories = true;
+	Settings.bShowIfNoFailures = false;
+	Settings.bLoadAssetsForValidation = true;
+	Settings.ValidationUsecase = EDataValidationUsecase::Commandlet;
+
+	FValidateAssetsResults Results;
+	ValidatorSubsystem->ValidateAssetsWithSettings(ChangedAssets, Settings, Results);
+	int32 NumErrors = Results.NumInvalid;
+
+	// A changed asset can push its referencers over their budget without failing validation itself
+	TArray<FName> Referencers;
+	FindTransitiveReferencers(AssetRegistry, ChangedPackages, Referencers);
+
+	UE_LOG(LogCommonValidators, Display, TEXT("Validating heavy references of %d referencing assets"), Referencers.Num());
+
+	// Kept alive across the garbage collections below
+	TStrongObjectPtr<UEditorValidator_HeavyReference> HeavyReferenceValidator(NewObject<UEditorValidator_HeavyReference>(GetTransientPackage()));
+	int32 NumLoaded = 0;
+	for (const FName& PackageName : Referencers)
+	{
+		// Bypassing the subsystem, so apply its excluded directories like the changed asset pass does
+		const FAssetData AssetData = UCommonValidatorsStatics::GetMainAssetData(AssetRegistry, PackageName);
+		if (!AssetData.IsValid() || ValidatorSubsystem->IsPathExcludedFromValidation(PackageName.ToString()))
+		{
+			continue;
+		}
+
+		if (++NumLoaded % GarbageCollectionInterval == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+
+		FDataValidationContext Context(/*bWasAssetLoadedForValidation=*/true, EDataValidationUsecase::Commandlet, {});
+		if (HeavyReferenceValidator->ValidateAsset(AssetData, Context) == EDataValidationResult::Invalid)
+		{
+			++NumErrors;
+		}
+
+		for (const FDataValidationContext::FIssue& Issue : Context.GetIssues())
+		{
+			const FString Message = Issue.TokenizedMessage.IsValid() ? Issue.TokenizedMessage->ToText().ToString() : Issue.Message.ToString();
+			if (Issue.Severity == EMessageSeverity::Error)
+			{
+				UE_LOG(LogCommonValidators, Error, TEXT("%s: %s"), *PackageName.ToString(), *Message);
+			}
+			else
+			{
+				UE_LOG(LogCommonValidators, Warning, TEXT("%s: %s"), *PackageName.ToString(), *Message);
+			}
+		}
+	}
+
+	UE_LOG(LogCommonValidators, Display, TEXT("Change set validation finished with %d invalid assets"), NumErrors);
+	return NumErrors > 0 ? 1 : 0;
+}
+
+bool UCommonValidatorsChangeSetCommandlet::ReadChangedPackages(const FString& Filename, TArray<FName>& OutPackageNames)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		return false;
+	}
+
+	for (FString& Line : Lines)
+	{
+		Line.TrimStartAndEndInline();
+		if (Line.IsEmpty())
+		{
+			continue;
+		}
+
+		FString PackageName;
+		if (Line.StartsWith(TEXT("/")) && FPackageName::IsValidLongPackageName(Line))
+		{
+			PackageName = Line;
+		}
+		else if (FPackageName::IsPackageFilename(Line))
+		{
+			// Paths from source control are relative to the project
+			const FString AbsolutePath = FPaths::IsRelative(Line) ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Line) : Line;
+			if (!FPackageName::TryConvertFilenameToLongPackageName(AbsolutePath, PackageName))
+			{
+				UE_LOG(LogCommonValidators, Verbose, TEXT("Skipping %s, not under a mounted content directory"), *Line);
+				continue;
+			}
+		}
+		else
+		{
+			continue;
+		}
+
+		OutPackageNames.AddUnique(FName(PackageName));
+	}
+
+	return true;
+}
+
+void UCommonValidatorsChangeSetCommandlet::FindTransitiveReferencers(const IAssetRegistry& AssetRegistry, TConstArrayView<FName> ChangedPackages, TArray<FName>& OutReferencers)
+{
+	TSet<FName> Visited(ChangedPackages);
+	TArray<FName> Pending(ChangedPackages);
+
+	TArray<FName> Referencers;
+	while (!Pending.IsEmpty())
+	{
+		const FName PackageName = Pending.Pop();
+
+		Referencers.Reset();
+		// Same query the heavy reference closures use, editor-only referencers can't have moved
+		AssetRegistry.GetReferencers(PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::Package,
+			UE::AssetRegistry::EDependencyQuery::Hard | UE::AssetRegistry::EDependencyQuery::Game);
+
+		for (const FName& Referencer : Referencers)
+		{
+			bool bAlreadyVisited = false;
+			Visited.Add(Referencer, &bAlreadyVisited);
+			if (!bAlreadyVisited)
+			{
+				OutReferencers.Add(Referencer);
+				Pending.Add(Referencer);
+			}
+		}
+	}
+}
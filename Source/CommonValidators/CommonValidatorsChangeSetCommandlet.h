@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CommonValidatorsChangeSetCommandlet.generated.h"
+
+/**
+ * Validates only what a change can affect. The changed packages are validated with every validator, then the heavy
+ * reference validator runs again on every asset that hard references one of them, directly or not, since those are
+ * the closures whose size could have moved.
+ *
+ * Usage: -run=CommonValidatorsChangeSet -ChangedPackages=<File>
+ * The file lists one package name (/Game/...) or content file path (absolute or relative to the project, e.g. the output of git diff --name-only) per line.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UCommonValidatorsChangeSetCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCommonValidatorsChangeSetCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+	// Package names of the content files and package names listed in the file, anything else is skipped
+	static bool ReadChangedPackages(const FString& Filename, TArray<FName>& OutPackageNames);
+
+	// Every package hard referencing one of the changed packages, directly or through other packages, excluding the changed ones
+	static void FindTransitiveReferencers(const class IAssetRegistry& AssetRegistry, TConstArrayView<FName> ChangedPackages, TArray<FName>& OutReferencers);
+};
@@ -0,0 +1,718 @@
+// This Header
+#include "CommonValidatorsDependencyGraph.h"
+
+// Unreal
+#include "AssetManagerEditorModule.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/PackageName.h"
+#include "Serialization/Archive.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsSizeProvider.h"
+#include "CommonValidatorsStatics.h"
+
+namespace UE::Internal::DependencyGraphHelpers
+{
+	static constexpr uint32 SnapshotMagic = 0x43564447; // 'CVDG'
+	static constexpr uint32 SnapshotVersion = 3;
+
+	struct FSnapshotHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		int32 NumPackages;
+		int32 NumEdges;
+		// ECommonValidatorsSizeProvider the size column was filled with
+		uint32 SizeProvider;
+		// Estimate ratio of that provider
+		float SizeEstimateRatio;
+	};
+
+	static FIoHash GetSavedHash(const IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+		return PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash();
+	}
+} // namespace UE::Internal::DependencyGraphHelpers
+
+
+FCommonValidatorsDependencyGraph::FCommonValidatorsDependencyGraph() = default;
+
+FCommonValidatorsDependencyGraph::~FCommonValidatorsDependencyGraph()
+{
+	Reset();
+}
+
+void FCommonValidatorsDependencyGraph::BuildFromAssetRegistry(const IAssetRegistry& AssetRegistry)
+{
+	using namespace UE::Internal::DependencyGraphHelpers;
+
+	check(IsInGameThread());
+
+	Reset();
+
+	TArray<FAssetData> AllAssets;
+	AssetRegistry.GetAllAssets(AllAssets, /*bIncludeOnlyOnDiskAssets=*/true);
+
+	// Intern every package first so dependencies can be resolved to indices in one go
+	for (const FAssetData& AssetData : AllAssets)
+	{
+		if (IsMainAsset(AssetData) && !PackageIndices.Contains(AssetData.PackageName))
+		{
+			AddPackage(AssetData.PackageName);
+		}
+	}
+
+	ICommonValidatorsSizeProvider::Get().GetPackageSizes(PackageNames, PackageSizes);
+
+	OwnedOffsets.Reserve(PackageNames.Num() + 1);
+
+	TArray<FName> DependencyNames;
+	for (int32 PackageIndex = 0; PackageIndex < PackageNames.Num(); ++PackageIndex)
+	{
+		OwnedOffsets.Add(OwnedEdges.Num());
+
+		DependencyNames.Reset();
+		QueryPackage(AssetRegistry, PackageIndex, DependencyNames);
+
+		for (const FName DependencyName : DependencyNames)
+		{
+			const int32 DependencyIndex = FindPackageIndex(DependencyName);
+			if (DependencyIndex != INDEX_NONE && DependencyIndex != PackageIndex)
+			{
+				OwnedEdges.Add(DependencyIndex);
+			}
+		}
+	}
+
+	OwnedOffsets.Add(OwnedEdges.Num());
+
+	NumBasePackages = PackageNames.Num();
+	BaseOffsets = OwnedOffsets;
+	BaseEdges = OwnedEdges;
+	SizeProvider = ICommonValidatorsSizeProvider::Get().GetType();
+	SizeEstimateRatio = ICommonValidatorsSizeProvider::Get().GetEstimateRatio();
+}
+
+bool FCommonValidatorsDependencyGraph::SaveToFile(const FString& Filename) const
+{
+	using namespace UE::Internal::DependencyGraphHelpers;
+
+	// Compact: drop removed packages and fold the overlays back in
+	TArray<int32> NewIndices;
+	NewIndices.Init(INDEX_NONE, Num());
+	int32 NumLivePackages = 0;
+	for (int32 PackageIndex = 0; PackageIndex < Num(); ++PackageIndex)
+	{
+		if (IsValidPackage(PackageIndex))
+		{
+			NewIndices[PackageIndex] = NumLivePackages++;
+		}
+	}
+
+	TArray<int32> Offsets;
+	TArray<int32> Edges;
+	TArray<int64> Sizes;
+	TArray<FIoHash> Hashes;
+	Offsets.Reserve(NumLivePackages + 1);
+	Sizes.Reserve(NumLivePackages);
+	Hashes.Reserve(NumLivePackages);
+	for (int32 PackageIndex = 0; PackageIndex < Num(); ++PackageIndex)
+	{
+		if (NewIndices[PackageIndex] == INDEX_NONE)
+		{
+			continue;
+		}
+
+		Offsets.Add(Edges.Num());
+		for (const int32 Dependency : GetDependencies(PackageIndex))
+		{
+			if (NewIndices[Dependency] != INDEX_NONE)
+			{
+				Edges.Add(NewIndices[Dependency]);
+			}
+		}
+		Sizes.Add(PackageSizes[PackageIndex]);
+		Hashes.Add(PackageHashes[PackageIndex]);
+	}
+	Offsets.Add(Edges.Num());
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer)
+	{
+		return false;
+	}
+
+	FSnapshotHeader Header{ SnapshotMagic, SnapshotVersion, NumLivePackages, Edges.Num(), static_cast<uint32>(SizeProvider), SizeEstimateRatio };
+	Writer->Serialize(&Header, sizeof(Header));
+	Writer->Serialize(Offsets.GetData(), Offsets.Num() * sizeof(int32));
+	Writer->Serialize(Edges.GetData(), Edges.Num() * sizeof(int32));
+	Writer->Serialize(Sizes.GetData(), Sizes.Num() * sizeof(int64));
+	Writer->Serialize(Hashes.GetData(), Hashes.Num() * sizeof(FIoHash));
+
+	for (int32 PackageIndex = 0; PackageIndex < Num(); ++PackageIndex)
+	{
+		if (NewIndices[PackageIndex] == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FTCHARToUTF8 Utf8Name(*PackageNames[PackageIndex].ToString());
+		int32 NameLength = Utf8Name.Length();
+		*Writer << NameLength;
+		Writer->Serialize((void*)Utf8Name.Get(), NameLength);
+	}
+
+	return Writer->Close();
+}
+
+bool FCommonValidatorsDependencyGraph::LoadFromFile(const FString& Filename)
+{
+	using namespace UE::Internal::DependencyGraphHelpers;
+
+	Reset();
+
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (!MappedFile)
+	{
+		return false;
+	}
+
+	MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+	if (!MappedRegion)
+	{
+		Reset();
+		return false;
+	}
+
+	const uint8* const Data = MappedRegion->GetMappedPtr();
+	const int64 DataSize = MappedRegion->GetMappedSize();
+
+	FSnapshotHeader Header;
+	if (DataSize < int64(sizeof(Header)))
+	{
+		Reset();
+		return false;
+	}
+	FMemory::Memcpy(&Header, Data, sizeof(Header));
+
+	const int64 ArraysSize = (int64(Header.NumPackages) + 1) * sizeof(int32) + int64(Header.NumEdges) * sizeof(int32)
+		+ int64(Header.NumPackages) * (sizeof(int64) + sizeof(FIoHash));
+	// A size column from another provider, or scaled by another ratio, is useless, start over
+	const ICommonValidatorsSizeProvider& CurrentProvider = ICommonValidatorsSizeProvider::Get();
+	if (Header.Magic != SnapshotMagic || Header.Version != SnapshotVersion || Header.NumPackages < 0 || Header.NumEdges < 0
+		|| Header.SizeProvider != static_cast<uint32>(CurrentProvider.GetType()) || Header.SizeEstimateRatio != CurrentProvider.GetEstimateRatio()
+		|| DataSize < int64(sizeof(Header)) + ArraysSize)
+	{
+		Reset();
+		return false;
+	}
+
+	const uint8* Cursor = Data + sizeof(Header);
+	BaseOffsets = TConstArrayView<int32>(reinterpret_cast<const int32*>(Cursor), Header.NumPackages + 1);
+	Cursor += BaseOffsets.NumBytes();
+	BaseEdges = TConstArrayView<int32>(reinterpret_cast<const int32*>(Cursor), Header.NumEdges);
+	Cursor += BaseEdges.NumBytes();
+
+	// GetDependencies trusts the adjacency, a corrupted file must not get that far
+	if (!AreBaseArraysValid(Header.NumPackages, Header.NumEdges))
+	{
+		UE_LOG(LogCommonValidators, Warning, TEXT("Dependency graph snapshot %s is corrupted, rebuilding it."), *Filename);
+		Reset();
+		return false;
+	}
+
+	// Columns that get patched are copied out, the adjacency stays in the mapping
+	PackageSizes.SetNumUninitialized(Header.NumPackages);
+	FMemory::Memcpy(PackageSizes.GetData(), Cursor, PackageSizes.NumBytes());
+	Cursor += PackageSizes.NumBytes();
+	PackageHashes.SetNumUninitialized(Header.NumPackages);
+	FMemory::Memcpy(PackageHashes.GetData(), Cursor, PackageHashes.NumBytes());
+	Cursor += PackageHashes.NumBytes();
+
+	const uint8* const End = Data + DataSize;
+	PackageNames.Reserve(Header.NumPackages);
+	PackageIndices.Reserve(Header.NumPackages);
+	for (int32 PackageIndex = 0; PackageIndex < Header.NumPackages; ++PackageIndex)
+	{
+		int32 NameLength = 0;
+		if (End - Cursor < int64(sizeof(NameLength)))
+		{
+			Reset();
+			return false;
+		}
+		FMemory::Memcpy(&NameLength, Cursor, sizeof(NameLength));
+		Cursor += sizeof(NameLength);
+
+		if (NameLength < 0 || End - Cursor < NameLength)
+		{
+			Reset();
+			return false;
+		}
+
+		const FUTF8ToTCHAR Name(reinterpret_cast<const UTF8CHAR*>(Cursor), NameLength);
+		Cursor += NameLength;
+
+		const FName PackageName(Name.Length(), Name.Get());
+		PackageIndices.Add(PackageName, PackageIndex);
+		PackageNames.Add(PackageName);
+	}
+
+	NumBasePackages = Header.NumPackages;
+	OverlaySlots.Init(INDEX_NONE, Header.NumPackages);
+	SizeProvider = static_cast<ECommonValidatorsSizeProvider>(Header.SizeProvider);
+	SizeEstimateRatio = Header.SizeEstimateRatio;
+	return true;
+}
+
+bool FCommonValidatorsDependencyGraph::AreBaseArraysValid(int32 NumPackages, int32 NumEdges) const
+{
+	if (BaseOffsets[0] != 0 || BaseOffsets[NumPackages] != NumEdges)
+	{
+		return false;
+	}
+
+	for (int32 PackageIndex = 0; PackageIndex < NumPackages; ++PackageIndex)
+	{
+		if (BaseOffsets[PackageIndex] > BaseOffsets[PackageIndex + 1])
+		{
+			return false;
+		}
+	}
+
+	for (const int32 Edge : BaseEdges)
+	{
+		if (Edge < 0 || Edge >= NumPackages)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FCommonValidatorsDependencyGraph::IsMainAsset(const FAssetData& AssetData)
+{
+	const FString PackageNameString = AssetData.PackageName.ToString();
+	if (PackageNameString.StartsWith(TEXT("/Script/")))
+	{
+		return false;
+	}
+
+	return AssetData.AssetName == FName(FPackageName::GetLongPackageAssetName(PackageNameString));
+}
+
+int32 FCommonValidatorsDependencyGraph::ReconcileWithAssetRegistry(const IAssetRegistry& AssetRegistry)
+{
+	using namespace UE::Internal::DependencyGraphHelpers;
+
+	check(IsInGameThread());
+
+	TArray<FAssetData> AllAssets;
+	AssetRegistry.GetAllAssets(AllAssets, /*bIncludeOnlyOnDiskAssets=*/true);
+
+	int32 NumPatched = 0;
+	TArray<FName> StalePackages;
+	TBitArray<> Seen(false, Num());
+	for (const FAssetData& AssetData : AllAssets)
+	{
+		if (!IsMainAsset(AssetData))
+		{
+			continue;
+		}
+
+		const int32 PackageIndex = FindPackageIndex(AssetData.PackageName);
+		if (PackageIndex != INDEX_NONE)
+		{
+			Seen[PackageIndex] = true;
+			if (PackageHashes[PackageIndex] == GetSavedHash(AssetRegistry, AssetData.PackageName))
+			{
+				continue;
+			}
+		}
+
+		StalePackages.Add(AssetData.PackageName);
+		++NumPatched;
+	}
+
+	TSet<FName> UpdatedPackages(StalePackages);
+	int32 FirstNewPackage = Num();
+	UpdatePackages(AssetRegistry, StalePackages);
+
+	// The snapshot dropped edges to packages that were missing when it was saved. Referencers of packages that are
+	// back didn't change, so their hash still matches: re-query them too, until no more packages are added.
+	TArray<FName> Referencers;
+	while (FirstNewPackage < Num())
+	{
+		TArray<FName> ReferencersToUpdate;
+		for (int32 PackageIndex = FirstNewPackage; PackageIndex < Num(); ++PackageIndex)
+		{
+			Referencers.Reset();
+			AssetRegistry.GetReferencers(PackageNames[PackageIndex], Referencers, UE::AssetRegistry::EDependencyCategory::Package,
+				UE::AssetRegistry::EDependencyQuery::Hard | UE::AssetRegistry::EDependencyQuery::Game);
+
+			for (const FName Referencer : Referencers)
+			{
+				bool bAlreadyUpdated = false;
+				if (FindPackageIndex(Referencer) != INDEX_NONE)
+				{
+					UpdatedPackages.Add(Referencer, &bAlreadyUpdated);
+					if (!bAlreadyUpdated)
+					{
+						ReferencersToUpdate.Add(Referencer);
+					}
+				}
+			}
+		}
+
+		FirstNewPackage = Num();
+		UpdatePackages(AssetRegistry, ReferencersToUpdate);
+		NumPatched += ReferencersToUpdate.Num();
+	}
+
+	for (int32 PackageIndex = 0; PackageIndex < Seen.Num(); ++PackageIndex)
+	{
+		if (!Seen[PackageIndex] && IsValidPackage(PackageIndex))
+		{
+			RemovePackage(PackageNames[PackageIndex]);
+			++NumPatched;
+		}
+	}
+
+	return NumPatched;
+}
+
+void FCommonValidatorsDependencyGraph::UpdatePackages(const IAssetRegistry& AssetRegistry, TConstArrayView<FName> InPackageNames)
+{
+	using namespace UE::Internal::DependencyGraphHelpers;
+
+	check(IsInGameThread());
+
+	TArray<FName> PendingPackages(InPackageNames);
+	TArray<FName> DependencyNames;
+	TArray<FName> PackagesToSize;
+	while (PendingPackages.Num() > 0)
+	{
+		const FName PendingPackage = PendingPackages.Pop();
+
+		const FAssetData MainAsset = UCommonValidatorsStatics::GetMainAssetData(AssetRegistry, PendingPackage);
+		if (!MainAsset.IsValid())
+		{
+			RemovePackage(PendingPackage);
+			continue;
+		}
+
+		int32 PackageIndex = FindPackageIndex(PendingPackage);
+		if (PackageIndex == INDEX_NONE)
+		{
+			PackageIndex = AddPackage(PendingPackage);
+		}
+
+		DependencyNames.Reset();
+		QueryPackage(AssetRegistry, PackageIndex, DependencyNames);
+		PackagesToSize.Add(PendingPackage);
+
+		TArray<int32> Dependencies;
+		for (const FName DependencyName : DependencyNames)
+		{
+			int32 DependencyIndex = FindPackageIndex(DependencyName);
+
+			// First reference to a package we haven't seen, bring it in too
+			if (DependencyIndex == INDEX_NONE && UCommonValidatorsStatics::GetMainAssetData(AssetRegistry, DependencyName).IsValid())
+			{
+				DependencyIndex = AddPackage(DependencyName);
+				PendingPackages.Add(DependencyName);
+			}
+
+			if (DependencyIndex != INDEX_NONE && DependencyIndex != PackageIndex)
+			{
+				Dependencies.AddUnique(DependencyIndex);
+			}
+		}
+
+		SetOverlayDependencies(PackageIndex, MoveTemp(Dependencies));
+	}
+
+	// Size everything touched in one batch
+	TArray<int64> Sizes;
+	Sizes.SetNumUninitialized(PackagesToSize.Num());
+	ICommonValidatorsSizeProvider::Get().GetPackageSizes(PackagesToSize, Sizes);
+	for (int32 Index = 0; Index < PackagesToSize.Num(); ++Index)
+	{
+		const int32 PackageIndex = FindPackageIndex(PackagesToSize[Index]);
+		if (PackageIndex != INDEX_NONE)
+		{
+			PackageSizes[PackageIndex] = Sizes[Index];
+		}
+	}
+}
+
+void FCommonValidatorsDependencyGraph::RefreshSizes()
+{
+	check(IsInGameThread());
+
+	ICommonValidatorsSizeProvider& Provider = ICommonValidatorsSizeProvider::Get();
+	Provider.GetPackageSizes(PackageNames, PackageSizes);
+	SizeProvider = Provider.GetType();
+	SizeEstimateRatio = Provider.GetEstimateRatio();
+
+	// Removed slots keep a zero size
+	for (int32 PackageIndex = 0; PackageIndex < Num(); ++PackageIndex)
+	{
+		if (!IsValidPackage(PackageIndex))
+		{
+			PackageSizes[PackageIndex] = 0;
+		}
+	}
+}
+
+void FCommonValidatorsDependencyGraph::RemovePackage(FName PackageName)
+{
+	int32 PackageIndex = INDEX_NONE;
+	if (!PackageIndices.RemoveAndCopyValue(PackageName, PackageIndex))
+	{
+		return;
+	}
+
+	// Keep the slot so other packages' edges stay valid, and so the package gets it back if it is re-added
+	RemovedPackageIndices.Add(PackageName, PackageIndex);
+	PackageNames[PackageIndex] = NAME_None;
+	PackageSizes[PackageIndex] = 0;
+	PackageHashes[PackageIndex] = FIoHash();
+	SetOverlayDependencies(PackageIndex, TArray<int32>());
+}
+
+uint64 FCommonValidatorsDependencyGraph::ComputeClosureSize(int32 RootIndex, TFunctionRef<bool(int32)> ShouldInclude, TArray<int32>* OutUnsizedPackages) const
+{
+	// Ignore ourselves in this calc. We are not a reference: we are us.
+	TBitArray<> Visited(false, Num());
+	Visited[RootIndex] = true;
+
+	return ComputeReachableSize(GetDependencies(RootIndex), ShouldInclude, Visited, OutUnsizedPackages);
+}
+
+uint64 FCommonValidatorsDependencyGraph::ComputeReachableSize(TConstArrayView<int32> SeedIndices, TFunctionRef<bool(int32)> ShouldInclude, TBitArray<>& InOutVisited,
+	TArray<int32>* OutUnsizedPackages, TArray<int32>* OutNewlyVisited) const
+{
+	check(InOutVisited.Num() == Num());
+
+	TArray<int32> Queue;
+	for (const int32 SeedIndex : SeedIndices)
+	{
+		if (!InOutVisited[SeedIndex])
+		{
+			InOutVisited[SeedIndex] = true;
+			Queue.Add(SeedIndex);
+		}
+	}
+
+	if (OutNewlyVisited)
+	{
+		OutNewlyVisited->Append(Queue);
+	}
+
+	uint64 TotalSize = 0;
+	while (Queue.Num() > 0)
+	{
+		const int32 PackageIndex = Queue.Pop();
+
+		if (!IsValidPackage(PackageIndex) || !ShouldInclude(PackageIndex))
+		{
+			continue;
+		}
+
+		if (IsPackageSized(PackageIndex))
+		{
+			TotalSize += GetPackageSize(PackageIndex);
+		}
+		else if (OutUnsizedPackages)
+		{
+			OutUnsizedPackages->Add(PackageIndex);
+		}
+
+		for (const int32 Dependency : GetDependencies(PackageIndex))
+		{
+			if (!InOutVisited[Dependency])
+			{
+				InOutVisited[Dependency] = true;
+				Queue.Add(Dependency);
+
+				if (OutNewlyVisited)
+				{
+					OutNewlyVisited->Add(Dependency);
+				}
+			}
+		}
+	}
+
+	return TotalSize;
+}
+
+int32 FCommonValidatorsDependencyGraph::FindStronglyConnectedComponents(int32 NumNodes, TFunctionRef<TConstArrayView<int32>(int32)> GetEdges, TArray<int32>& OutComponentOfNode)
+{
+	struct FVisitFrame
+	{
+		int32 Node;
+		int32 NextEdge;
+	};
+
+	TArray<int32> VisitIndex;
+	TArray<int32> LowLink;
+	VisitIndex.Init(INDEX_NONE, NumNodes);
+	LowLink.Init(INDEX_NONE, NumNodes);
+	OutComponentOfNode.Init(INDEX_NONE, NumNodes);
+
+	TBitArray<> OnStack(false, NumNodes);
+	TArray<int32> ComponentStack;
+	TArray<FVisitFrame> CallStack;
+	int32 NextVisitIndex = 0;
+	int32 NumComponents = 0;
+
+	auto Visit = [&](int32 Node)
+	{
+		VisitIndex[Node] = LowLink[Node] = NextVisitIndex++;
+		ComponentStack.Push(Node);
+		OnStack[Node] = true;
+		CallStack.Add({ Node, 0 });
+	};
+
+	for (int32 Root = 0; Root < NumNodes; ++Root)
+	{
+		if (VisitIndex[Root] != INDEX_NONE)
+		{
+			continue;
+		}
+
+		Visit(Root);
+		while (CallStack.Num() > 0)
+		{
+			const int32 Node = CallStack.Last().Node;
+			const TConstArrayView<int32> NodeEdges = GetEdges(Node);
+
+			if (CallStack.Last().NextEdge < NodeEdges.Num())
+			{
+				const int32 Next = NodeEdges[CallStack.Last().NextEdge++];
+				if (VisitIndex[Next] == INDEX_NONE)
+				{
+					Visit(Next);
+				}
+				else if (OnStack[Next])
+				{
+					LowLink[Node] = FMath::Min(LowLink[Node], VisitIndex[Next]);
+				}
+				continue;
+			}
+
+			CallStack.Pop();
+
+			// Root of a component: everything above it on the stack belongs to it
+			if (LowLink[Node] == VisitIndex[Node])
+			{
+				int32 Member = INDEX_NONE;
+				do
+				{
+					Member = ComponentStack.Pop();
+					OnStack[Member] = false;
+					OutComponentOfNode[Member] = NumComponents;
+				}
+				while (Member != Node);
+
+				++NumComponents;
+			}
+
+			if (CallStack.Num() > 0)
+			{
+				const int32 Parent = CallStack.Last().Node;
+				LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[Node]);
+			}
+		}
+	}
+
+	return NumComponents;
+}
+
+void FCommonValidatorsDependencyGraph::Reset()
+{
+	PackageNames.Reset();
+	PackageIndices.Reset();
+	RemovedPackageIndices.Reset();
+	PackageSizes.Reset();
+	PackageHashes.Reset();
+
+	NumBasePackages = 0;
+	BaseOffsets = TConstArrayView<int32>();
+	BaseEdges = TConstArrayView<int32>();
+	OwnedOffsets.Reset();
+	OwnedEdges.Reset();
+
+	OverlaySlots.Reset();
+	OverlayEdges.Reset();
+
+	// Views above may point into the mapping, release it last
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+int32 FCommonValidatorsDependencyGraph::AddPackage(FName PackageName)
+{
+	// Deleted then restored, reverted or replaced by a redirector: referencers still point at the old slot
+	int32 PackageIndex = INDEX_NONE;
+	if (RemovedPackageIndices.RemoveAndCopyValue(PackageName, PackageIndex))
+	{
+		PackageNames[PackageIndex] = PackageName;
+		PackageIndices.Add(PackageName, PackageIndex);
+		PackageSizes[PackageIndex] = INDEX_NONE;
+		return PackageIndex;
+	}
+
+	PackageIndex = PackageNames.Add(PackageName);
+	PackageIndices.Add(PackageName, PackageIndex);
+	PackageSizes.Add(INDEX_NONE);
+	PackageHashes.AddDefaulted();
+	OverlaySlots.Add(INDEX_NONE);
+	return PackageIndex;
+}
+
+void FCommonValidatorsDependencyGraph::SetOverlayDependencies(int32 PackageIndex, TArray<int32>&& Dependencies)
+{
+	if (OverlaySlots[PackageIndex] == INDEX_NONE)
+	{
+		OverlaySlots[PackageIndex] = OverlayEdges.Add(MoveTemp(Dependencies));
+	}
+	else
+	{
+		OverlayEdges[OverlaySlots[PackageIndex]] = MoveTemp(Dependencies);
+	}
+}
+
+void FCommonValidatorsDependencyGraph::QueryPackage(const IAssetRegistry& AssetRegistry, int32 PackageIndex, TArray<FName>& OutDependencyNames)
+{
+	using namespace UE::Internal::DependencyGraphHelpers;
+
+	IAssetManagerEditorModule& EditorModule = IAssetManagerEditorModule::Get();
+	const FName PackageName = PackageNames[PackageIndex];
+
+	PackageHashes[PackageIndex] = GetSavedHash(AssetRegistry, PackageName);
+
+	FAssetManagerDependencyQuery DependencyQuery = FAssetManagerDependencyQuery::None();
+	DependencyQuery.Categories = UE::AssetRegistry::EDependencyCategory::Package;
+	DependencyQuery.Flags = UE::AssetRegistry::EDependencyQuery::Game | UE::AssetRegistry::EDependencyQuery::Hard;
+
+	TArray<FAssetIdentifier> Dependencies;
+	AssetRegistry.GetDependencies(FAssetIdentifier(PackageName), Dependencies, DependencyQuery.Categories, DependencyQuery.Flags);
+	EditorModule.FilterAssetIdentifiersForCurrentRegistrySource(Dependencies, DependencyQuery, true);
+
+	for (const FAssetIdentifier& Dependency : Dependencies)
+	{
+		if (Dependency.IsPackage())
+		{
+			OutDependencyNames.AddUnique(Dependency.PackageName);
+		}
+	}
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IO/IoHash.h"
+#include "CommonValidatorsDeveloperSettings.h"
+
+struct FAssetData;
+class IAssetRegistry;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Flat, index based copy of the hard package dependency graph of the project.
+ * Package names are interned to indices, adjacency is stored as CSR (offsets + edges)
+ * and the size of every package is stored in a column alongside.
+ *
+ * Only packages that the heavy reference validator would traverse are nodes:
+ * content packages with a main asset. Edges to anything else are dropped.
+ *
+ * The CSR arrays can live in a memory mapped snapshot file. Packages changed after the snapshot
+ * was taken are patched on top: their adjacency moves to an owned overlay, removed packages keep
+ * their index (so other edges stay valid) but lose their name, edges and size until the same name is added again.
+ */
+class COMMONVALIDATORS_API FCommonValidatorsDependencyGraph
+{
+public:
+	FCommonValidatorsDependencyGraph();
+	~FCommonValidatorsDependencyGraph();
+
+	FCommonValidatorsDependencyGraph(const FCommonValidatorsDependencyGraph&) = delete;
+	FCommonValidatorsDependencyGraph& operator=(const FCommonValidatorsDependencyGraph&) = delete;
+
+	// Only main assets (PackageName.PackageShortName) of content packages are nodes, the same rule the heavy reference
+	// validator uses to look packages up. Other assets in the same package don't change the graph.
+	static bool IsMainAsset(const FAssetData& AssetData);
+
+	// Rebuilds the whole graph from the asset registry. Must be called on the game thread.
+	void BuildFromAssetRegistry(const IAssetRegistry& AssetRegistry);
+
+	// Writes a compacted snapshot (tombstones dropped, overlays folded back into the CSR arrays)
+	bool SaveToFile(const FString& Filename) const;
+
+	// Maps a snapshot written by SaveToFile. Adjacency is read straight from the mapping.
+	bool LoadFromFile(const FString& Filename);
+
+	// Patches every package whose saved hash no longer matches the registry, adds new packages (re-querying their referencers,
+	// whose edges to them were dropped while they were missing) and removes deleted ones.
+	// @return The number of packages that were patched
+	int32 ReconcileWithAssetRegistry(const IAssetRegistry& AssetRegistry);
+
+	// Re-queries packages (adding them if needed) and any newly referenced packages
+	void UpdatePackages(const IAssetRegistry& AssetRegistry, TConstArrayView<FName> InPackageNames);
+
+	void UpdatePackage(const IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		UpdatePackages(AssetRegistry, MakeArrayView(&PackageName, 1));
+	}
+
+	// Re-sizes every package with the currently selected size provider
+	void RefreshSizes();
+
+	// Provider the size column was filled with
+	ECommonValidatorsSizeProvider GetSizeProvider() const { return SizeProvider; }
+
+	// Estimate ratio of that provider when the size column was filled
+	float GetSizeEstimateRatio() const { return SizeEstimateRatio; }
+
+	void RemovePackage(FName PackageName);
+
+	void Reset();
+
+	// Number of package slots, including removed ones
+	int32 Num() const { return PackageNames.Num(); }
+
+	bool IsValidPackage(int32 PackageIndex) const { return PackageNames[PackageIndex] != NAME_None; }
+
+	int32 FindPackageIndex(FName PackageName) const
+	{
+		const int32* Found = PackageIndices.Find(PackageName);
+		return Found ? *Found : INDEX_NONE;
+	}
+
+	FName GetPackageName(int32 PackageIndex) const { return PackageNames[PackageIndex]; }
+
+	// Size in bytes, 0 when the package could not be sized
+	int64 GetPackageSize(int32 PackageIndex) const { return FMath::Max<int64>(PackageSizes[PackageIndex], 0); }
+
+	bool IsPackageSized(int32 PackageIndex) const { return PackageSizes[PackageIndex] >= 0; }
+
+	TConstArrayView<int32> GetDependencies(int32 PackageIndex) const
+	{
+		if (OverlaySlots[PackageIndex] != INDEX_NONE)
+		{
+			return OverlayEdges[OverlaySlots[PackageIndex]];
+		}
+
+		if (PackageIndex >= NumBasePackages)
+		{
+			return TConstArrayView<int32>();
+		}
+
+		const int32 Begin = BaseOffsets[PackageIndex];
+		return TConstArrayView<int32>(BaseEdges.GetData() + Begin, BaseOffsets[PackageIndex + 1] - Begin);
+	}
+
+	/**
+	 * Deduplicated size of everything RootIndex hard references, excluding the root itself.
+	 * Packages rejected by ShouldInclude are neither sized nor walked through.
+	 */
+	uint64 ComputeClosureSize(int32 RootIndex, TFunctionRef<bool(int32)> ShouldInclude, TArray<int32>* OutUnsizedPackages = nullptr) const;
+
+	/**
+	 * Deduplicated size of the seeds and everything they hard reference.
+	 * Packages already set in InOutVisited are skipped and everything reached is set, so successive calls only size what
+	 * earlier calls didn't reach. InOutVisited must hold Num() bits.
+	 * OutNewlyVisited receives every bit this call set, so callers can clear them again instead of copying InOutVisited.
+	 */
+	uint64 ComputeReachableSize(TConstArrayView<int32> SeedIndices, TFunctionRef<bool(int32)> ShouldInclude, TBitArray<>& InOutVisited,
+		TArray<int32>* OutUnsizedPackages = nullptr, TArray<int32>* OutNewlyVisited = nullptr) const;
+
+	/**
+	 * Tarjan's strongly connected components, iterative so deep dependency chains can't overflow the stack.
+	 * Components are numbered in reverse topological order: everything a component depends on has a lower id.
+	 * @return The number of components
+	 */
+	static int32 FindStronglyConnectedComponents(int32 NumNodes, TFunctionRef<TConstArrayView<int32>(int32)> GetEdges, TArray<int32>& OutComponentOfNode);
+
+	int32 FindStronglyConnectedComponents(TArray<int32>& OutComponentOfPackage) const
+	{
+		return FindStronglyConnectedComponents(Num(), [this](int32 PackageIndex) { return GetDependencies(PackageIndex); }, OutComponentOfPackage);
+	}
+
+private:
+	// Offsets start at 0, never decrease and end at NumEdges, every edge is a package index
+	bool AreBaseArraysValid(int32 NumPackages, int32 NumEdges) const;
+
+	int32 AddPackage(FName PackageName);
+	void SetOverlayDependencies(int32 PackageIndex, TArray<int32>&& Dependencies);
+	void QueryPackage(const IAssetRegistry& AssetRegistry, int32 PackageIndex, TArray<FName>& OutDependencyNames);
+
+	TArray<FName> PackageNames;
+	TMap<FName, int32> PackageIndices;
+	// Slots of removed packages, reused when the same name is added again
+	TMap<FName, int32> RemovedPackageIndices;
+
+	// -1 when the package could not be sized
+	TArray<int64> PackageSizes;
+	ECommonValidatorsSizeProvider SizeProvider = ECommonValidatorsSizeProvider::ResourceSize;
+	float SizeEstimateRatio = 1.0f;
+
+	// Saved hash of each package when it was last queried, used to find stale entries in a loaded snapshot
+	TArray<FIoHash> PackageHashes;
+
+	// Dependencies of base package i are BaseEdges[BaseOffsets[i] .. BaseOffsets[i + 1]).
+	// Views into either the owned arrays or the mapped snapshot.
+	int32 NumBasePackages = 0;
+	TConstArrayView<int32> BaseOffsets;
+	TConstArrayView<int32> BaseEdges;
+	TArray<int32> OwnedOffsets;
+	TArray<int32> OwnedEdges;
+
+	// Patched adjacency, INDEX_NONE in OverlaySlots when a package still uses the base arrays
+	TArray<int32> OverlaySlots;
+	TArray<TArray<int32>> OverlayEdges;
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+};
@@ -0,0 +1,182 @@
+// This Header
+#include "CommonValidatorsDependencySnapshot.h"
+
+// Unreal
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsSizeProvider.h"
+#include "CommonValidatorsStatics.h"
+
+FCommonValidatorsDependencySnapshot& FCommonValidatorsDependencySnapshot::Get()
+{
+	static FCommonValidatorsDependencySnapshot Instance;
+	return Instance;
+}
+
+FString FCommonValidatorsDependencySnapshot::GetSnapshotFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("CommonValidators") / TEXT("DependencyGraph.bin");
+}
+
+void FCommonValidatorsDependencySnapshot::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	// Always keep an in-memory graph patched once something has asked for it, even when it isn't persisted
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FCommonValidatorsDependencySnapshot::OnAssetAddedOrUpdated);
+	OnAssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FCommonValidatorsDependencySnapshot::OnAssetAddedOrUpdated);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FCommonValidatorsDependencySnapshot::OnAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FCommonValidatorsDependencySnapshot::OnAssetRenamed);
+
+	if (!GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableDependencyGraphSnapshot)
+	{
+		return;
+	}
+
+	bLoadedFromFile = Graph.LoadFromFile(GetSnapshotFilename());
+
+	if (AssetRegistry.IsLoadingAssets())
+	{
+		OnFilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddRaw(this, &FCommonValidatorsDependencySnapshot::OnFilesLoaded);
+	}
+	else
+	{
+		OnFilesLoaded();
+	}
+}
+
+void FCommonValidatorsDependencySnapshot::Shutdown()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnFilesLoaded().Remove(OnFilesLoadedHandle);
+		AssetRegistry->OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry->OnAssetUpdated().Remove(OnAssetUpdatedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(OnAssetRenamedHandle);
+	}
+
+	// The adjacency may still be mapped from the old snapshot, so write next to it and swap once it's released
+	const bool bShouldSave = bIsReady && bIsDirty && GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableDependencyGraphSnapshot;
+	const FString Filename = GetSnapshotFilename();
+	const FString TempFilename = Filename + TEXT(".tmp");
+	const bool bSaved = bShouldSave && Graph.SaveToFile(TempFilename);
+
+	Graph.Reset();
+	++Version;
+	bIsReady = false;
+	bIsDirty = false;
+
+	if (bSaved)
+	{
+		IFileManager::Get().Move(*Filename, *TempFilename, /*bReplace=*/true);
+	}
+}
+
+bool FCommonValidatorsDependencySnapshot::EnsureReady(IAssetRegistry& AssetRegistry)
+{
+	if (!bIsReady && !AssetRegistry.IsLoadingAssets())
+	{
+		OnFilesLoaded();
+	}
+
+	return bIsReady;
+}
+
+void FCommonValidatorsDependencySnapshot::OnSizeProviderChanged()
+{
+	// Sizes cached by the provider were computed with the old ratio too
+	ICommonValidatorsSizeProvider& Provider = ICommonValidatorsSizeProvider::Get();
+	Provider.ResetCache();
+
+	if (bIsReady && (Graph.GetSizeProvider() != Provider.GetType() || Graph.GetSizeEstimateRatio() != Provider.GetEstimateRatio()))
+	{
+		Graph.RefreshSizes();
+		++Version;
+		bIsDirty = true;
+	}
+}
+
+void FCommonValidatorsDependencySnapshot::OnFilesLoaded()
+{
+	if (bIsReady)
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (bLoadedFromFile)
+	{
+		const int32 NumPatched = Graph.ReconcileWithAssetRegistry(AssetRegistry);
+		bIsDirty = NumPatched > 0;
+
+		UE_LOG(LogCommonValidators, Log, TEXT("Loaded dependency graph snapshot with %d packages, patched %d in %.2fs."),
+			Graph.Num(), NumPatched, FPlatformTime::Seconds() - StartTime);
+	}
+	else
+	{
+		Graph.BuildFromAssetRegistry(AssetRegistry);
+		bIsDirty = false;
+
+		// Nothing is mapped yet, so the snapshot can be written straight away
+		const FString Filename = GetSnapshotFilename();
+		if (GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableDependencyGraphSnapshot)
+		{
+			IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), /*Tree=*/true);
+			bIsDirty = !Graph.SaveToFile(Filename);
+		}
+
+		UE_LOG(LogCommonValidators, Log, TEXT("Built dependency graph with %d packages in %.2fs."), Graph.Num(), FPlatformTime::Seconds() - StartTime);
+	}
+
+	++Version;
+	bIsReady = true;
+}
+
+void FCommonValidatorsDependencySnapshot::OnAssetAddedOrUpdated(const FAssetData& AssetData)
+{
+	if (!bIsReady || !FCommonValidatorsDependencyGraph::IsMainAsset(AssetData))
+	{
+		return;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	Graph.UpdatePackage(AssetRegistry, AssetData.PackageName);
+	++Version;
+	bIsDirty = true;
+}
+
+void FCommonValidatorsDependencySnapshot::OnAssetRemoved(const FAssetData& AssetData)
+{
+	if (!bIsReady || !FCommonValidatorsDependencyGraph::IsMainAsset(AssetData))
+	{
+		return;
+	}
+
+	Graph.RemovePackage(AssetData.PackageName);
+	++Version;
+	bIsDirty = true;
+}
+
+void FCommonValidatorsDependencySnapshot::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (!bIsReady)
+	{
+		return;
+	}
+
+	Graph.RemovePackage(FName(FPackageName::ObjectPathToPackageName(OldObjectPath)));
+	OnAssetAddedOrUpdated(AssetData);
+	++Version;
+	bIsDirty = true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CommonValidatorsDependencyGraph.h"
+
+class IAssetRegistry;
+struct FAssetData;
+
+/**
+ * Owns the project's dependency graph for the editor session.
+ *
+ * The graph is persisted under Saved/CommonValidators and memory mapped at startup, reconciled against the
+ * asset registry once discovery finishes, then patched package by package from registry change events.
+ * Closure queries run over its flat arrays instead of going through the registry.
+ */
+class COMMONVALIDATORS_API FCommonValidatorsDependencySnapshot
+{
+public:
+	static FCommonValidatorsDependencySnapshot& Get();
+
+	// Called on module startup/shutdown
+	void Initialize();
+	void Shutdown();
+
+	// True once the graph matches the asset registry
+	bool IsReady() const { return bIsReady; }
+
+	// Brings the graph up to date right away, building it from scratch if there is no snapshot.
+	// Returns false while the asset registry is still discovering assets.
+	bool EnsureReady(IAssetRegistry& AssetRegistry);
+
+	const FCommonValidatorsDependencyGraph& GetGraph() const { return Graph; }
+
+	// Changes whenever the graph does, for results computed from it that are worth keeping between validations
+	uint32 GetVersion() const { return Version; }
+
+	// Re-sizes the graph after HeavyReferenceSizeProvider or CookedSizeEstimateRatio changed
+	void OnSizeProviderChanged();
+
+	static FString GetSnapshotFilename();
+
+private:
+	void OnFilesLoaded();
+	void OnAssetAddedOrUpdated(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	FCommonValidatorsDependencyGraph Graph;
+	uint32 Version = 0;
+	bool bIsReady = false;
+	bool bIsDirty = false;
+	bool bLoadedFromFile = false;
+
+	FDelegateHandle OnFilesLoadedHandle;
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetUpdatedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+};
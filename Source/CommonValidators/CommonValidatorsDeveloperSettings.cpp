@@ -1 +1,30 @@
 #include "CommonValidatorsDeveloperSettings.h"
+
+#include "CommonValidatorsDependencySnapshot.h"
+#include "HeavyReferenceClosureCache.h"
+#include "HeavyReferenceResidentBaseline.h"
+
+#if WITH_EDITOR
+void UCommonValidatorsDeveloperSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Cached sizes came from the previous provider or ratio
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UCommonValidatorsDeveloperSettings, HeavyReferenceSizeProvider)
+		|| PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UCommonValidatorsDeveloperSettings, CookedSizeEstimateRatio))
+	{
+		FCommonValidatorsDependencySnapshot::Get().OnSizeProviderChanged();
+		FHeavyReferenceClosureCache::Get().Reset();
+		FHeavyReferenceResidentBaseline::Get().Reset();
+	}
+
+	// Roots are only gathered when the baseline is built
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UCommonValidatorsDeveloperSettings, bIncludeGameDefaultsInResidentBaseline)
+		|| PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UCommonValidatorsDeveloperSettings, ResidentBaselineAssets)
+		|| PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UCommonValidatorsDeveloperSettings, ResidentBaselinePrimaryAssetTypes)
+		|| PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UCommonValidatorsDeveloperSettings, ResidentBaselineBundles))
+	{
+		FHeavyReferenceResidentBaseline::Get().Reset();
+	}
+}
+#endif
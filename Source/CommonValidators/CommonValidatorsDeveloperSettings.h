@@ -4,9 +4,22 @@
 #include "Templates/SubclassOf.h"
 #include "Animation/AnimBlueprint.h"
 #include "Engine/DeveloperSettings.h"
+#include "UObject/PrimaryAssetId.h"
 
 #include "CommonValidatorsDeveloperSettings.generated.h"
 
+// How the heavy reference validator sizes each package in a closure
+UENUM()
+enum class ECommonValidatorsSizeProvider : uint8
+{
+	// Resource size reported by the Asset Manager editor columns. Can be missing for unloaded assets.
+	ResourceSize,
+	// Uncompressed size of the package file on disk
+	PackageFileSize,
+	// Cooked size from the current registry source when available, otherwise scaled from the package size
+	CookedSizeEstimate,
+};
+
 USTRUCT(BlueprintType)
 struct FCommonValidatorClassArray
 {
@@ -41,6 +54,10 @@ public:
 	//If true, we throw an error, otherwise a warning!
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnablePureNodeMultiExecValidator == true"))
 	bool bErrorOnPureNodeMultiExec = true;
+
+	// Classes whose pure functions are cheap enough to evaluate more than once, on top of the engine's math, string and container libraries. Includes subclasses.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnablePureNodeMultiExecValidator == true"))
+	TArray<TSubclassOf<UObject>> HarmlessPureNodeClasses;
 	
 	// If true, we will validate for blocking loads in blueprints
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
@@ -50,7 +67,40 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableBlockingLoadValidator == true"))
 	bool bErrorBlockingLoad = true;
 
-	// If true, we will validate for references above the set value in blueprints
+	// If true, we will validate tick settings and component layout of actor and component blueprints
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableComponentTickValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableComponentTickValidator == true"))
+	bool bErrorOnComponentTick = false;
+
+	// Maximum number of components (native and blueprint added, including inherited) on an actor. 0 disables the check.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableComponentTickValidator == true", ClampMin = 0))
+	int MaximumComponentCount = 32;
+
+	// Maximum depth of the scene component attachment hierarchy on an actor. 0 disables the check.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableComponentTickValidator == true", ClampMin = 0))
+	int MaximumSceneComponentDepth = 6;
+
+	// If true, costs measured at runtime by the CommonValidatorsRuntimeSampler module are reported on the blueprints they were measured in
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableRuntimeSampleValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableRuntimeSampleValidator == true"))
+	bool bErrorOnRuntimeSamples = false;
+
+	// Record synchronous package loads and blueprint tick costs during every PIE session.
+	// Samples are merged into Saved/CommonValidators/RuntimeSamples.json when the session ends.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableRuntimeSampleValidator == true"))
+	bool bRecordRuntimeSamplesInPIE = false;
+
+	// Measured blueprint ticks that take longer than this on average are reported
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableRuntimeSampleValidator == true", ClampMin = 0.0))
+	float RuntimeTickBudgetMilliseconds = 0.1f;
+
+	// If true, we will validate for references above the set value in assets
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
 	bool bEnableHeavyReferenceValidator = true;
 
@@ -58,6 +108,24 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
 	int MaximumAllowedReferenceSizeKiloBytes = 20480;
 
+	// Budgets for specific asset classes and their children, used instead of MaximumAllowedReferenceSizeKiloBytes. The most derived matching class wins.
+	// Blueprints match on their parent class, so an entry for Character applies to every character blueprint.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
+	TMap<TSubclassOf<UObject>, int32> HeavyReferenceClassBudgetsKiloBytes;
+
+	// For maps, the most a single streamed World Partition actor or streaming level may add on top of the always loaded content.
+	// The always loaded content itself is checked against the regular budget. 0 disables the check.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true", ClampMin = 0))
+	int MaximumAllowedStreamedReferenceSizeKiloBytes = 10240;
+
+	// How each referenced package is sized. Package file size and cooked estimate never need the asset loaded.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
+	ECommonValidatorsSizeProvider HeavyReferenceSizeProvider = ECommonValidatorsSizeProvider::ResourceSize;
+
+	// Cooked size estimate as a fraction of the editor package size, used when no cooked size is known
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true && HeavyReferenceSizeProvider == ECommonValidatorsSizeProvider::CookedSizeEstimate", ClampMin = 0.0))
+	float CookedSizeEstimateRatio = 0.6f;
+
 	// Whether an inability to gather the size of a child asset is an warning
 	// This will prevent further context messages in most cases
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
@@ -67,6 +135,16 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
 	bool bErrorHeavyReference = false;
 
+	// In commandlets (CI, batch validation), compute every asset's closure size in one pass over the whole dependency graph
+	// instead of walking each validated asset's closure separately. Not used for assets with class specific ignore rules.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
+	bool bPrecomputeHeavyReferenceClosuresInCommandlets = true;
+
+	// Keep a compact snapshot of the package dependency graph under Saved/CommonValidators, memory mapped on startup and
+	// patched from asset registry events. Heavy reference closures are then walked over flat arrays instead of registry queries.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true", ConfigRestartRequired = true))
+	bool bEnableDependencyGraphSnapshot = true;
+
 	// Classes in this list, and their children, are ignored by heavy reference validator
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
 	TArray<TSubclassOf<UObject>> HeavyValidatorClassAndChildIgnoreList = {UAnimBlueprint::StaticClass()};
@@ -74,4 +152,177 @@ public:
 	// Classes in this list, and only classes in this list, are ignored by heavy reference validator
 	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
 	TMap<TSubclassOf<UObject>, FCommonValidatorClassArray> HeavyValidatorClassSpecificClassIgnoreList;
+
+	// Subtract the closure of content the game keeps resident from heavy reference totals, so assets are only charged for what loading them adds.
+	// Maps that are part of the baseline are still sized in full.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true"))
+	bool bSubtractResidentBaseline = false;
+
+	// Add the game default map, the game instance class and the global default game mode to the resident baseline
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true && bSubtractResidentBaseline == true"))
+	bool bIncludeGameDefaultsInResidentBaseline = true;
+
+	// Other assets kept loaded for the whole session, e.g. a game data asset or the HUD
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true && bSubtractResidentBaseline == true"))
+	TArray<TSoftObjectPtr<UObject>> ResidentBaselineAssets;
+
+	// Primary asset types whose assets stay loaded for the whole session
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true && bSubtractResidentBaseline == true"))
+	TArray<FPrimaryAssetType> ResidentBaselinePrimaryAssetTypes;
+
+	// Bundles loaded along with the primary assets of ResidentBaselinePrimaryAssetTypes
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableHeavyReferenceValidator == true && bSubtractResidentBaseline == true"))
+	TArray<FName> ResidentBaselineBundles;
+
+	// If true, we will validate blueprints for hard reference cycles that force groups of packages to load together
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableReferenceCycleValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableReferenceCycleValidator == true"))
+	bool bErrorOnReferenceCycle = false;
+
+	// How many of the references that break the most of a cycle are reported
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableReferenceCycleValidator == true", ClampMin = 1))
+	int MaximumReportedCycleEdges = 5;
+
+	// If true, we will validate bindings, tick and hierarchy depth of widget blueprints
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableWidgetBlueprintValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableWidgetBlueprintValidator == true"))
+	bool bErrorOnWidgetBlueprint = false;
+
+	// Maximum number of property bindings in a widget. Every binding is evaluated each frame while the widget is visible.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableWidgetBlueprintValidator == true", ClampMin = 0))
+	int MaximumWidgetBindings = 5;
+
+	// Maximum depth of the widget hierarchy. Every level adds layout and paint cost. 0 disables the check.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableWidgetBlueprintValidator == true", ClampMin = 0))
+	int MaximumWidgetTreeDepth = 12;
+
+	// Functions that are flagged when called from a binding, directly or through functions of the same widget
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableWidgetBlueprintValidator == true"))
+	TArray<FName> ExpensiveWidgetBindingFunctions = {
+		TEXT("GetAllActorsOfClass"), TEXT("GetAllActorsOfClassWithTag"), TEXT("GetAllActorsWithTag"), TEXT("GetAllActorsWithInterface"),
+		TEXT("GetAllWidgetsOfClass"), TEXT("GetAllWidgetsWithInterface"), TEXT("GetComponentsByClass"), TEXT("K2_GetComponentsByClass"),
+		TEXT("LineTraceSingle"), TEXT("LineTraceMulti"), TEXT("SphereTraceSingle"), TEXT("SphereTraceMulti"),
+		TEXT("LoadAsset_Blocking"), TEXT("LoadClassAsset_Blocking") };
+
+	// If true, we will estimate the work done by actor construction scripts
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableConstructionScriptValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableConstructionScriptValidator == true"))
+	bool bErrorOnConstructionScript = false;
+
+	// Iterations assumed for loops whose count isn't known in the graph, e.g. ForEachLoop over an array
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableConstructionScriptValidator == true", ClampMin = 1))
+	int ConstructionScriptAssumedLoopIterations = 10;
+
+	// Maximum estimated node executions per construction. Construction scripts run on every spawn and every property change in the editor.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableConstructionScriptValidator == true", ClampMin = 0))
+	int MaximumConstructionScriptNodes = 200;
+
+	// Maximum estimated actor spawns and added components per construction
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableConstructionScriptValidator == true", ClampMin = 0))
+	int MaximumConstructionScriptSpawns = 10;
+
+	// Maximum estimated traces and overlap queries per construction
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableConstructionScriptValidator == true", ClampMin = 0))
+	int MaximumConstructionScriptTraces = 2;
+
+	// Maximum estimated dynamic material instances created per construction
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableConstructionScriptValidator == true", ClampMin = 0))
+	int MaximumConstructionScriptDynamicMaterials = 4;
+
+	// If true, we will validate simulation cost and scalability setup of Niagara systems
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableNiagaraSystemValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableNiagaraSystemValidator == true"))
+	bool bErrorOnNiagaraSystem = false;
+
+	// Maximum estimated live particles of a CPU simulated emitter, move bigger emitters to the GPU
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableNiagaraSystemValidator == true", ClampMin = 0))
+	int MaximumNiagaraCPUParticles = 1000;
+
+	// Maximum constant spawn rate of an emitter, in particles per second
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableNiagaraSystemValidator == true", ClampMin = 0.0))
+	float MaximumNiagaraSpawnRate = 500.0f;
+
+	// If true, systems whose bounds are computed every frame are flagged
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableNiagaraSystemValidator == true"))
+	bool bRequireNiagaraFixedBounds = true;
+
+	// If true, systems without an effect type, culling or significance handler are flagged
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableNiagaraSystemValidator == true"))
+	bool bRequireNiagaraScalability = true;
+
+	// If true, we will estimate shader permutations of materials and flag material instances compiling their own shaders
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableMaterialPermutationValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableMaterialPermutationValidator == true"))
+	bool bErrorOnMaterialPermutations = false;
+
+	// Maximum estimated shader permutations of a material: vertex factories from usage flags, times quality levels, times static switch combinations
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableMaterialPermutationValidator == true", ClampMin = 1))
+	int MaximumMaterialPermutations = 256;
+
+	// Maximum static switch and static component mask parameters exposed by a material
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableMaterialPermutationValidator == true", ClampMin = 0))
+	int MaximumMaterialStaticSwitches = 6;
+
+	// If true, material instances overriding static parameters are flagged, each one compiles its own set of shaders
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableMaterialPermutationValidator == true"))
+	bool bFlagMaterialInstanceStaticOverrides = true;
+
+	// If true, we will validate blueprint function, event dispatcher and interface parameters for large copies
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableByValueParameterValidator = true;
+
+	//If true, we throw an error for parameters copied every frame or inside loops, otherwise a warning! Others are always performance warnings.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableByValueParameterValidator == true"))
+	bool bErrorOnHotByValueParameters = false;
+
+	// Struct and container parameters estimated to copy more than this per call are flagged
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableByValueParameterValidator == true", ClampMin = 0))
+	int MaximumByValueParameterBytes = 128;
+
+	// Elements assumed in arrays, sets and maps when estimating a copy, their size is only known at runtime
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableByValueParameterValidator == true", ClampMin = 1))
+	int ByValueParameterAssumedContainerElements = 8;
+
+	// If true, we will validate what the asset bundles of primary data assets load against streaming budgets
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators")
+	bool bEnableAssetBundleValidator = true;
+
+	//If true, we throw an error, otherwise a performance warning!
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableAssetBundleValidator == true"))
+	bool bErrorOnAssetBundles = false;
+
+	// The most a single bundle may load on top of the primary asset, for bundles without an entry in AssetBundleBudgetsKiloBytes. 0 disables the check.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableAssetBundleValidator == true", ClampMin = 0))
+	int MaximumAssetBundleSizeKiloBytes = 51200;
+
+	// Budgets for specific bundle names, e.g. Game or UI
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableAssetBundleValidator == true"))
+	TMap<FName, int32> AssetBundleBudgetsKiloBytes;
+
+	// The most all bundles of an asset may load together, content shared between bundles counted once. 0 disables the check.
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableAssetBundleValidator == true", ClampMin = 0))
+	int MaximumAssetBundlesTotalSizeKiloBytes = 0;
+
+	// How many of the largest bundle entries are listed for a bundle over budget
+	UPROPERTY(Config, EditAnywhere, Category="Common Validators", meta = (EditCondition = "bEnableAssetBundleValidator == true", ClampMin = 1))
+	int MaximumReportedAssetBundleContributors = 5;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 };
\ No newline at end of file
@@ -0,0 +1,144 @@
+// This Header
+#include "CommonValidatorsRuntimeSamples.h"
+
+// Unreal
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "IO/IoHash.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(CommonValidatorsRuntimeSamples)
+
+FCommonValidatorsRuntimeSamples& FCommonValidatorsRuntimeSamples::Get()
+{
+	static FCommonValidatorsRuntimeSamples Instance;
+	return Instance;
+}
+
+FString FCommonValidatorsRuntimeSamples::GetSamplesFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("CommonValidators") / TEXT("RuntimeSamples.json");
+}
+
+FString FCommonValidatorsRuntimeSamples::GetSavedHash(const UBlueprint& Blueprint)
+{
+	return LexToString(Blueprint.GetPackage()->GetSavedHash());
+}
+
+bool FCommonValidatorsRuntimeSamples::MergeIntoFile(TConstArrayView<FCommonValidatorsRuntimeSample> NewSamples)
+{
+	FCommonValidatorsRuntimeSampleFile File;
+	LoadFile(File);
+
+	// The blueprint was saved since these were recorded, nothing measured on the old version still holds
+	File.Samples.RemoveAll([NewSamples](const FCommonValidatorsRuntimeSample& Sample)
+	{
+		return NewSamples.ContainsByPredicate([&Sample](const FCommonValidatorsRuntimeSample& NewSample)
+		{
+			return NewSample.Blueprint == Sample.Blueprint && NewSample.BlueprintSavedHash != Sample.BlueprintSavedHash;
+		});
+	});
+
+	for (const FCommonValidatorsRuntimeSample& NewSample : NewSamples)
+	{
+		if (FCommonValidatorsRuntimeSample* Existing = File.Samples.FindByPredicate([&NewSample](const FCommonValidatorsRuntimeSample& Sample) { return Sample.HasSameKey(NewSample); }))
+		{
+			Existing->Accumulate(NewSample);
+		}
+		else
+		{
+			File.Samples.Add(NewSample);
+		}
+	}
+
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(File, Json))
+	{
+		return false;
+	}
+
+	if (!FFileHelper::SaveStringToFile(Json, *GetSamplesFilename()))
+	{
+		UE_LOG(LogCommonValidators, Warning, TEXT("Failed to write runtime samples to %s"), *GetSamplesFilename());
+		return false;
+	}
+
+	return true;
+}
+
+bool FCommonValidatorsRuntimeSamples::LoadFile(FCommonValidatorsRuntimeSampleFile& OutFile)
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *GetSamplesFilename()))
+	{
+		return false;
+	}
+
+	if (!FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutFile))
+	{
+		UE_LOG(LogCommonValidators, Warning, TEXT("Ignoring unreadable runtime samples in %s"), *GetSamplesFilename());
+		OutFile.Samples.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FCommonValidatorsRuntimeSamples::ClearFile()
+{
+	IFileManager::Get().Delete(*GetSamplesFilename(), /*RequireExists=*/false, /*EvenReadOnly=*/true);
+}
+
+void FCommonValidatorsRuntimeSamples::GetSamplesForBlueprint(const UBlueprint& Blueprint, TArray<FCommonValidatorsRuntimeSample>& OutSamples)
+{
+	ReloadIfChanged();
+
+	const TArray<FCommonValidatorsRuntimeSample>* Samples = SamplesByBlueprint.Find(Blueprint.GetPathName());
+	if (!Samples)
+	{
+		return;
+	}
+
+	// Samples from before the last save may be about a tick or load that has been fixed since
+	const FString SavedHash = GetSavedHash(Blueprint);
+	for (const FCommonValidatorsRuntimeSample& Sample : *Samples)
+	{
+		if (Sample.BlueprintSavedHash == SavedHash)
+		{
+			OutSamples.Add(Sample);
+		}
+	}
+}
+
+void FCommonValidatorsRuntimeSamples::ReloadIfChanged()
+{
+	// FDateTime::MinValue when the file doesn't exist
+	const FDateTime Timestamp = IFileManager::Get().GetTimeStamp(*GetSamplesFilename());
+	if (Timestamp == LoadedTimestamp)
+	{
+		return;
+	}
+
+	LoadedTimestamp = Timestamp;
+	SamplesByBlueprint.Reset();
+
+	FCommonValidatorsRuntimeSampleFile File;
+	if (!LoadFile(File))
+	{
+		return;
+	}
+
+	for (FCommonValidatorsRuntimeSample& Sample : File.Samples)
+	{
+		SamplesByBlueprint.FindOrAdd(Sample.Blueprint).Add(MoveTemp(Sample));
+	}
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CommonValidatorsRuntimeSamples.generated.h"
+
+class UBlueprint;
+
+UENUM()
+enum class ECommonValidatorsRuntimeSampleKind : uint8
+{
+	// A package was loaded synchronously while blueprint script was running
+	SyncLoad,
+	// A blueprint tick event ran
+	Tick,
+};
+
+/**
+ * One aggregated runtime measurement, keyed by kind, blueprint, graph, node and loaded package.
+ * Written by the CommonValidatorsRuntimeSampler module, read back by UEditorValidator_RuntimeSamples.
+ */
+USTRUCT()
+struct COMMONVALIDATORS_API FCommonValidatorsRuntimeSample
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	ECommonValidatorsRuntimeSampleKind Kind = ECommonValidatorsRuntimeSampleKind::SyncLoad;
+
+	// Object path of the blueprint the script belongs to
+	UPROPERTY()
+	FString Blueprint;
+
+	// Saved hash of the blueprint's package when recorded, samples of any other version of the blueprint are stale
+	UPROPERTY()
+	FString BlueprintSavedHash;
+
+	// Graph the script was compiled from, e.g. EventGraph or a function name
+	UPROPERTY()
+	FName Graph;
+
+	// Node the script was compiled from, invalid for tick samples
+	UPROPERTY()
+	FGuid Node;
+
+	// Package that was loaded, empty for tick samples
+	UPROPERTY()
+	FString LoadedPackage;
+
+	UPROPERTY()
+	int32 Count = 0;
+
+	UPROPERTY()
+	double TotalMilliseconds = 0.0;
+
+	UPROPERTY()
+	double MaxMilliseconds = 0.0;
+
+	bool HasSameKey(const FCommonValidatorsRuntimeSample& Other) const
+	{
+		return Kind == Other.Kind && Graph == Other.Graph && Node == Other.Node && Blueprint == Other.Blueprint && LoadedPackage == Other.LoadedPackage;
+	}
+
+	void Accumulate(const FCommonValidatorsRuntimeSample& Other)
+	{
+		Count += Other.Count;
+		TotalMilliseconds += Other.TotalMilliseconds;
+		MaxMilliseconds = FMath::Max(MaxMilliseconds, Other.MaxMilliseconds);
+	}
+};
+
+USTRUCT()
+struct COMMONVALIDATORS_API FCommonValidatorsRuntimeSampleFile
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FCommonValidatorsRuntimeSample> Samples;
+};
+
+/**
+ * Runtime samples persisted under Saved/CommonValidators, indexed by blueprint for validation.
+ * The file is re-read whenever its timestamp changes, so samples recorded in another session show up on the next validation.
+ * Samples only apply to the version of the blueprint they were recorded on, saving the blueprint retires them.
+ */
+class COMMONVALIDATORS_API FCommonValidatorsRuntimeSamples
+{
+public:
+	static FCommonValidatorsRuntimeSamples& Get();
+
+	static FString GetSamplesFilename();
+
+	static FString GetSavedHash(const UBlueprint& Blueprint);
+
+	// Adds NewSamples to the samples already on disk, replacing those recorded on an older version of the same blueprint
+	static bool MergeIntoFile(TConstArrayView<FCommonValidatorsRuntimeSample> NewSamples);
+
+	static bool LoadFile(FCommonValidatorsRuntimeSampleFile& OutFile);
+
+	// Deletes the samples file
+	static void ClearFile();
+
+	// Samples recorded on the current saved version of the blueprint. Game thread only.
+	void GetSamplesForBlueprint(const UBlueprint& Blueprint, TArray<FCommonValidatorsRuntimeSample>& OutSamples);
+
+private:
+	void ReloadIfChanged();
+
+	FDateTime LoadedTimestamp;
+	TMap<FString, TArray<FCommonValidatorsRuntimeSample>> SamplesByBlueprint;
+};
@@ -0,0 +1,215 @@
+// This Header
+#include "CommonValidatorsSizeProvider.h"
+
+// Unreal
+#include "AssetManagerEditorModule.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/PackageName.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsStatics.h"
+
+namespace UE::Internal::SizeProviderHelpers
+{
+	struct FPackageFileStat
+	{
+		FDateTime ModificationTime = FDateTime::MinValue();
+		int64 FileSize = INDEX_NONE;
+	};
+
+	// Resolves filenames on the game thread, then stats every file in parallel
+	static void StatPackageFiles(TConstArrayView<FName> PackageNames, TArray<FPackageFileStat>& OutStats)
+	{
+		TArray<FString> Filenames;
+		Filenames.SetNum(PackageNames.Num());
+		for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+		{
+			FString PackageFilename;
+			if (FPackageName::TryConvertLongPackageNameToFilename(PackageNames[Index].ToString(), PackageFilename))
+			{
+				Filenames[Index] = MoveTemp(PackageFilename);
+			}
+		}
+
+		OutStats.Reset();
+		OutStats.SetNum(PackageNames.Num());
+
+		IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+		ParallelFor(Filenames.Num(), [&Filenames, &OutStats, &PlatformFile](int32 Index)
+		{
+			if (Filenames[Index].IsEmpty())
+			{
+				return;
+			}
+
+			// Maps are the only packages not saved as .uasset
+			FFileStatData StatData = PlatformFile.GetStatData(*(Filenames[Index] + FPackageName::GetAssetPackageExtension()));
+			if (!StatData.bIsValid)
+			{
+				StatData = PlatformFile.GetStatData(*(Filenames[Index] + FPackageName::GetMapPackageExtension()));
+			}
+
+			if (StatData.bIsValid && !StatData.bIsDirectory)
+			{
+				OutStats[Index].ModificationTime = StatData.ModificationTime;
+				OutStats[Index].FileSize = StatData.FileSize;
+			}
+		});
+	}
+
+	/**
+	 * Uncompressed package file size, straight from the file stats.
+	 */
+	class FPackageFileSizeProvider : public ICommonValidatorsSizeProvider
+	{
+	public:
+		virtual ECommonValidatorsSizeProvider GetType() const override { return ECommonValidatorsSizeProvider::PackageFileSize; }
+
+		virtual void GetPackageSizes(TConstArrayView<FName> PackageNames, TArrayView<int64> OutSizes) override
+		{
+			TArray<FPackageFileStat> Stats;
+			StatPackageFiles(PackageNames, Stats);
+
+			for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+			{
+				OutSizes[Index] = Stats[Index].FileSize;
+			}
+		}
+	};
+
+	/**
+	 * Base for providers that go through the registry or editor columns.
+	 * Results are cached per package and reused as long as the package file timestamp doesn't change.
+	 */
+	class FTimestampCachedSizeProvider : public ICommonValidatorsSizeProvider
+	{
+	public:
+		virtual void GetPackageSizes(TConstArrayView<FName> PackageNames, TArrayView<int64> OutSizes) override
+		{
+			check(IsInGameThread());
+
+			TArray<FPackageFileStat> Stats;
+			StatPackageFiles(PackageNames, Stats);
+
+			const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+			for (int32 Index = 0; Index < PackageNames.Num(); ++Index)
+			{
+				const FCachedSize* Cached = Cache.Find(PackageNames[Index]);
+				if (Cached && Cached->ModificationTime == Stats[Index].ModificationTime)
+				{
+					OutSizes[Index] = Cached->Size;
+					continue;
+				}
+
+				const FAssetData MainAsset = UCommonValidatorsStatics::GetMainAssetData(AssetRegistry, PackageNames[Index]);
+				OutSizes[Index] = MainAsset.IsValid() ? ComputeSize(AssetRegistry, MainAsset, Stats[Index]) : INDEX_NONE;
+				Cache.Add(PackageNames[Index], { Stats[Index].ModificationTime, OutSizes[Index] });
+			}
+		}
+
+		virtual void ResetCache() override
+		{
+			Cache.Reset();
+		}
+
+	protected:
+		virtual int64 ComputeSize(const IAssetRegistry& AssetRegistry, const FAssetData& MainAsset, const FPackageFileStat& Stat) const = 0;
+
+	private:
+		struct FCachedSize
+		{
+			FDateTime ModificationTime;
+			int64 Size;
+		};
+
+		TMap<FName, FCachedSize> Cache;
+	};
+
+	/**
+	 * The Asset Manager editor's resource size column, what the validator has always used.
+	 */
+	class FResourceSizeProvider : public FTimestampCachedSizeProvider
+	{
+	public:
+		virtual ECommonValidatorsSizeProvider GetType() const override { return ECommonValidatorsSizeProvider::ResourceSize; }
+
+	protected:
+		virtual int64 ComputeSize(const IAssetRegistry& AssetRegistry, const FAssetData& MainAsset, const FPackageFileStat& Stat) const override
+		{
+			int64 FoundSize = 0;
+			if (IAssetManagerEditorModule::Get().GetIntegerValueForCustomColumn(MainAsset, IAssetManagerEditorModule::ResourceSizeName, FoundSize))
+			{
+				return FMath::Max<int64>(FoundSize, 0);
+			}
+			return INDEX_NONE;
+		}
+	};
+
+	/**
+	 * Cooked size when the registry knows it (staging tags, or the disk size column while a cooked development
+	 * asset registry is the Asset Audit's source), otherwise the editor package size scaled by CookedSizeEstimateRatio.
+	 */
+	class FCookedSizeEstimateProvider : public FTimestampCachedSizeProvider
+	{
+	public:
+		virtual ECommonValidatorsSizeProvider GetType() const override { return ECommonValidatorsSizeProvider::CookedSizeEstimate; }
+
+		virtual float GetEstimateRatio() const override { return GetDefault<UCommonValidatorsDeveloperSettings>()->CookedSizeEstimateRatio; }
+
+	protected:
+		virtual int64 ComputeSize(const IAssetRegistry& AssetRegistry, const FAssetData& MainAsset, const FPackageFileStat& Stat) const override
+		{
+			static const FName StageChunkSizeTag(TEXT("Stage_ChunkSize"));
+
+			int64 CookedSize = 0;
+			if (MainAsset.GetTagValue(StageChunkSizeTag, CookedSize) && CookedSize > 0)
+			{
+				return CookedSize;
+			}
+
+			// With the editor registry source the disk size column is just the uncompressed editor package
+			IAssetManagerEditorModule& EditorModule = IAssetManagerEditorModule::Get();
+			const FAssetManagerEditorRegistrySource* RegistrySource = EditorModule.GetCurrentRegistrySource();
+			if (RegistrySource && !RegistrySource->bIsEditor
+				&& EditorModule.GetIntegerValueForCustomColumn(MainAsset, IAssetManagerEditorModule::DiskSizeName, CookedSize) && CookedSize > 0)
+			{
+				return CookedSize;
+			}
+
+			if (Stat.FileSize < 0)
+			{
+				return INDEX_NONE;
+			}
+
+			return static_cast<int64>(static_cast<double>(Stat.FileSize) * GetEstimateRatio());
+		}
+	};
+} // namespace UE::Internal::SizeProviderHelpers
+
+
+ICommonValidatorsSizeProvider& ICommonValidatorsSizeProvider::Get()
+{
+	using namespace UE::Internal::SizeProviderHelpers;
+
+	static FResourceSizeProvider ResourceSizeProvider;
+	static FPackageFileSizeProvider PackageFileSizeProvider;
+	static FCookedSizeEstimateProvider CookedSizeEstimateProvider;
+
+	switch (GetDefault<UCommonValidatorsDeveloperSettings>()->HeavyReferenceSizeProvider)
+	{
+	case ECommonValidatorsSizeProvider::PackageFileSize:
+		return PackageFileSizeProvider;
+	case ECommonValidatorsSizeProvider::CookedSizeEstimate:
+		return CookedSizeEstimateProvider;
+	case ECommonValidatorsSizeProvider::ResourceSize:
+	default:
+		return ResourceSizeProvider;
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CommonValidatorsDeveloperSettings.h"
+
+/**
+ * Sizes packages for the heavy reference validator without loading them.
+ * The active provider is selected per project with UCommonValidatorsDeveloperSettings::HeavyReferenceSizeProvider.
+ */
+class COMMONVALIDATORS_API ICommonValidatorsSizeProvider
+{
+public:
+	virtual ~ICommonValidatorsSizeProvider() = default;
+
+	static ICommonValidatorsSizeProvider& Get();
+
+	virtual ECommonValidatorsSizeProvider GetType() const = 0;
+
+	// Ratio the sizes are scaled by, sizes computed with another ratio are stale. 1 for providers that don't scale.
+	virtual float GetEstimateRatio() const { return 1.0f; }
+
+	// Drops cached sizes so the next call recomputes them, e.g. after the ratio changed
+	virtual void ResetCache() {}
+
+	// Sizes a batch of packages in bytes. Packages that can't be sized get INDEX_NONE. Game thread only.
+	virtual void GetPackageSizes(TConstArrayView<FName> PackageNames, TArrayView<int64> OutSizes) = 0;
+
+	int64 GetPackageSize(FName PackageName)
+	{
+		int64 Size = INDEX_NONE;
+		GetPackageSizes(MakeArrayView(&PackageName, 1), MakeArrayView(&Size, 1));
+		return Size;
+	}
+};
@@ -3,12 +3,25 @@
 #include "CommonValidatorsStatics.h"
 
 // Unreal
+#include "Algo/NoneOf.h"
 #include "AssetManagerEditor/Public/AssetManagerEditorModule.h"
 #include "AssetRegistry/AssetDataToken.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
 #include "BlueprintEditorModule.h"
 #include "EdGraph/EdGraph.h"
 #include "EdGraph/EdGraphNode.h"
+#include "EdGraphSchema_K2.h"
+#include "HAL/IConsoleManager.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Composite.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_LoadAsset.h"
+#include "K2Node_Tunnel.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/PackageName.h"
 #include "ScopedTransaction.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "Toolkits/AssetEditorToolkit.h"
@@ -16,6 +29,508 @@
 // Project
 
 // Local
+#include "BlueprintGraphSnapshot.h"
+#include "EditorValidator_BlockingLoad.h"
+#include "EditorValidator_PureNode.h"
+
+namespace UE::Internal::CommonValidatorsStaticsHelpers
+{
+	static void AddExecSuccessors(UEdGraphNode* Node, TArray<UEdGraphNode*>& OutSuccessors)
+	{
+		for (UEdGraphPin* Pin : Node->Pins)
+		{
+			if (Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec || Pin->Direction != EGPD_Output)
+			{
+				continue;
+			}
+
+			for (UEdGraphPin* Link : Pin->LinkedTo)
+			{
+				OutSuccessors.Add(Link->GetOwningNode());
+			}
+		}
+	}
+
+	// Exec flow starts at nodes nothing executes: events, function entries and the entry tunnel of a collapsed graph
+	static bool IsExecRoot(const UEdGraphNode* Node)
+	{
+		bool bHasExecOutput = false;
+		for (const UEdGraphPin* Pin : Node->Pins)
+		{
+			if (Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+			{
+				continue;
+			}
+
+			if (Pin->Direction == EGPD_Input && Pin->LinkedTo.Num() > 0)
+			{
+				return false;
+			}
+
+			bHasExecOutput |= Pin->Direction == EGPD_Output;
+		}
+
+		return bHasExecOutput;
+	}
+
+	// Finds the sink that dominates every other sink: each exec path from a root of the graph to another sink goes through it,
+	// so a value set there has always been set when the other sinks run. Reaching the others isn't enough, another branch
+	// could get to them without passing through the candidate.
+	static UEdGraphNode* FindDominatingSink(UEdGraph* Graph, const TArray<UEdGraphNode*>& Sinks)
+	{
+		TArray<UEdGraphNode*> Roots;
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node && IsExecRoot(Node))
+			{
+				Roots.Add(Node);
+			}
+		}
+
+		for (UEdGraphNode* Candidate : Sinks)
+		{
+			// Walk from the roots without entering the candidate, any other sink still reached bypasses it
+			TSet<UEdGraphNode*> Reachable;
+			TArray<UEdGraphNode*> Queue;
+			for (UEdGraphNode* Root : Roots)
+			{
+				if (Root != Candidate)
+				{
+					Reachable.Add(Root);
+					Queue.Add(Root);
+				}
+			}
+
+			TArray<UEdGraphNode*> Successors;
+			while (Queue.Num() > 0)
+			{
+				Successors.Reset();
+				AddExecSuccessors(Queue.Pop(), Successors);
+				for (UEdGraphNode* Next : Successors)
+				{
+					bool bAlreadyReached = false;
+					if (Next != Candidate)
+					{
+						Reachable.Add(Next, &bAlreadyReached);
+						if (!bAlreadyReached)
+						{
+							Queue.Add(Next);
+						}
+					}
+				}
+			}
+
+			const bool bDominatesAll = Algo::NoneOf(Sinks, [Candidate, &Reachable](UEdGraphNode* Sink) { return Sink != Candidate && Reachable.Contains(Sink); });
+			if (bDominatesAll)
+			{
+				return Candidate;
+			}
+		}
+
+		return nullptr;
+	}
+
+	// Macro and collapsed node exec inputs are named after their tunnel pins, so only regular nodes have an Execute pin
+	static UEdGraphPin* FindExecInputPin(UEdGraphNode* Node)
+	{
+		if (UEdGraphPin* ExecutePin = Node->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input))
+		{
+			return ExecutePin;
+		}
+
+		for (UEdGraphPin* Pin : Node->Pins)
+		{
+			if (Pin->Direction == EGPD_Input && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec && Pin->LinkedTo.Num() > 0)
+			{
+				return Pin;
+			}
+		}
+
+		return nullptr;
+	}
+
+	static bool CachePureNodeResult(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node, FText& OutFailureReason)
+	{
+		UK2Node* PureNode = Cast<UK2Node>(Node);
+		if (!PureNode || !PureNode->IsNodePure())
+		{
+			OutFailureReason = NSLOCTEXT("CommonValidators", "CacheNotPure", "Node is not pure.");
+			return false;
+		}
+
+		const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+		const bool bIsFunctionGraph = Schema->GetGraphType(Graph) == GT_Function;
+		if (!bIsFunctionGraph && !Blueprint->UbergraphPages.Contains(Graph))
+		{
+			OutFailureReason = NSLOCTEXT("CommonValidators", "CacheUnsupportedGraph", "Only function and event graphs are supported.");
+			return false;
+		}
+
+		TArray<UEdGraphPin*> OutputPins;
+		for (UEdGraphPin* Pin : PureNode->Pins)
+		{
+			if (Pin->Direction != EGPD_Output || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+			{
+				continue;
+			}
+
+			if (Pin->SubPins.Num() > 0)
+			{
+				OutFailureReason = NSLOCTEXT("CommonValidators", "CacheSplitPin", "Split output pins aren't supported, recombine them first.");
+				return false;
+			}
+
+			if (Pin->LinkedTo.Num() > 0)
+			{
+				OutputPins.Add(Pin);
+			}
+		}
+
+		// A macro or collapsed node is a single sink but can evaluate the node several times itself, e.g. the Array input of a ForEachLoop
+		TArray<UEdGraphNode*> Sinks;
+		int32 NumEvaluations = 0;
+		UEditorValidator_PureNode::FindExecSinks(PureNode, Graph, Sinks, &NumEvaluations);
+		if (NumEvaluations < 2 || OutputPins.Num() == 0)
+		{
+			OutFailureReason = NSLOCTEXT("CommonValidators", "CacheSingleSink", "Node doesn't execute more than once.");
+			return false;
+		}
+
+		UEdGraphNode* FirstSink = FindDominatingSink(Graph, Sinks);
+		UEdGraphPin* SinkExecPin = FirstSink ? FindExecInputPin(FirstSink) : nullptr;
+		if (!SinkExecPin)
+		{
+			OutFailureReason = NSLOCTEXT("CommonValidators", "CacheNoCommonSink", "Not every use runs after a single one of them, there is no single place to cache the result.");
+			return false;
+		}
+
+		// Everything that can fail is checked or created before any existing link is touched, and undone on failure,
+		// so a failed fix leaves nothing behind in a transaction shared with other fixes
+		UEdGraph* FunctionGraph = bIsFunctionGraph ? FBlueprintEditorUtils::GetTopLevelGraph(Graph) : nullptr;
+		TArray<UK2Node_FunctionEntry*> FunctionEntries;
+		if (FunctionGraph)
+		{
+			FunctionGraph->GetNodesOfClass(FunctionEntries);
+			if (FunctionEntries.IsEmpty())
+			{
+				OutFailureReason = NSLOCTEXT("CommonValidators", "CacheNoFunctionEntry", "Function graph has no entry node to add a local variable to.");
+				return false;
+			}
+		}
+
+		struct FCachedOutput
+		{
+			UEdGraphPin* OutputPin = nullptr;
+			FName VariableName;
+			FMemberReference VariableReference;
+			UK2Node_VariableSet* SetNode = nullptr;
+			TArray<TPair<UEdGraphPin*, UK2Node_VariableGet*>> Getters;
+		};
+
+		TArray<FCachedOutput> CachedOutputs;
+		const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(PureNode);
+		const FString SourceName = CallNode ? CallNode->GetFunctionName().ToString() : PureNode->GetName();
+		for (UEdGraphPin* OutputPin : OutputPins)
+		{
+			FCachedOutput& CachedOutput = CachedOutputs.AddDefaulted_GetRef();
+			CachedOutput.OutputPin = OutputPin;
+			CachedOutput.VariableName = FBlueprintEditorUtils::FindUniqueKismetName(Blueprint, FString::Printf(TEXT("Cached_%s_%s"), *SourceName, *OutputPin->PinName.ToString()));
+		}
+
+		Blueprint->Modify();
+		Graph->Modify();
+		PureNode->Modify();
+		FirstSink->Modify();
+
+		TArray<FName> AddedVariables;
+		TArray<UEdGraphNode*> CreatedNodes;
+		auto Rollback = [&](const FText& Reason)
+		{
+			for (UEdGraphNode* CreatedNode : CreatedNodes)
+			{
+				CreatedNode->DestroyNode();
+			}
+
+			if (FunctionGraph)
+			{
+				FunctionEntries[0]->Modify();
+				FunctionEntries[0]->LocalVariables.RemoveAll([&AddedVariables](const FBPVariableDescription& Variable) { return AddedVariables.Contains(Variable.VarName); });
+			}
+			else
+			{
+				for (const FName& AddedVariable : AddedVariables)
+				{
+					FBlueprintEditorUtils::RemoveMemberVariable(Blueprint, AddedVariable);
+				}
+			}
+
+			OutFailureReason = Reason;
+			return false;
+		};
+
+		for (FCachedOutput& CachedOutput : CachedOutputs)
+		{
+			FEdGraphPinType VariableType = CachedOutput.OutputPin->PinType;
+			VariableType.bIsReference = false;
+			VariableType.bIsConst = false;
+
+			if (FunctionGraph)
+			{
+				if (!FBlueprintEditorUtils::AddLocalVariable(Blueprint, FunctionGraph, CachedOutput.VariableName, VariableType))
+				{
+					return Rollback(NSLOCTEXT("CommonValidators", "CacheAddLocalFailed", "Failed to add a local variable."));
+				}
+
+				const FBPVariableDescription* Description = FBlueprintEditorUtils::FindLocalVariable(Blueprint, FunctionGraph, CachedOutput.VariableName);
+				CachedOutput.VariableReference.SetLocalMember(CachedOutput.VariableName, FunctionGraph->GetName(), Description ? Description->VarGuid : FGuid());
+			}
+			else
+			{
+				if (!FBlueprintEditorUtils::AddMemberVariable(Blueprint, CachedOutput.VariableName, VariableType))
+				{
+					return Rollback(NSLOCTEXT("CommonValidators", "CacheAddMemberFailed", "Failed to add a member variable."));
+				}
+
+				CachedOutput.VariableReference.SetSelfMember(CachedOutput.VariableName);
+			}
+			AddedVariables.Add(CachedOutput.VariableName);
+		}
+
+		// Set the variable right before the first sink, chained if there are several outputs
+		int32 SetNodeIndex = 0;
+		for (FCachedOutput& CachedOutput : CachedOutputs)
+		{
+			FGraphNodeCreator<UK2Node_VariableSet> SetCreator(*Graph);
+			CachedOutput.SetNode = SetCreator.CreateNode(false);
+			CachedOutput.SetNode->VariableReference = CachedOutput.VariableReference;
+			CachedOutput.SetNode->NodePosX = FirstSink->NodePosX - 300;
+			CachedOutput.SetNode->NodePosY = FirstSink->NodePosY + 150 * SetNodeIndex++;
+			SetCreator.Finalize();
+			CreatedNodes.Add(CachedOutput.SetNode);
+
+			if (!CachedOutput.SetNode->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input)
+				|| !CachedOutput.SetNode->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output)
+				|| !CachedOutput.SetNode->FindPin(CachedOutput.VariableName, EGPD_Input))
+			{
+				return Rollback(NSLOCTEXT("CommonValidators", "CacheSetNodeFailed", "Failed to create the variable set node."));
+			}
+
+			// Every existing consumer reads the variable instead
+			for (UEdGraphPin* ConsumerPin : CachedOutput.OutputPin->LinkedTo)
+			{
+				UEdGraphNode* ConsumerNode = ConsumerPin->GetOwningNode();
+
+				FGraphNodeCreator<UK2Node_VariableGet> GetCreator(*Graph);
+				UK2Node_VariableGet* GetNode = GetCreator.CreateNode(false);
+				GetNode->VariableReference = CachedOutput.VariableReference;
+				GetNode->NodePosX = ConsumerNode->NodePosX - 200;
+				GetNode->NodePosY = ConsumerNode->NodePosY + 100;
+				GetCreator.Finalize();
+				CreatedNodes.Add(GetNode);
+
+				if (!GetNode->FindPin(CachedOutput.VariableName, EGPD_Output))
+				{
+					return Rollback(NSLOCTEXT("CommonValidators", "CacheGetNodeFailed", "Failed to create the variable get node."));
+				}
+
+				CachedOutput.Getters.Emplace(ConsumerPin, GetNode);
+			}
+		}
+
+		// Nothing can fail from here on
+		UEdGraphPin* PreviousThenPin = nullptr;
+		for (const FCachedOutput& CachedOutput : CachedOutputs)
+		{
+			UEdGraphPin* SetExecPin = CachedOutput.SetNode->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input);
+			if (PreviousThenPin)
+			{
+				Schema->TryCreateConnection(PreviousThenPin, SetExecPin);
+			}
+			else
+			{
+				// Whatever executed the first sink now executes the set node
+				const TArray<UEdGraphPin*> ExecSources = SinkExecPin->LinkedTo;
+				for (UEdGraphPin* ExecSource : ExecSources)
+				{
+					ExecSource->BreakLinkTo(SinkExecPin);
+					Schema->TryCreateConnection(ExecSource, SetExecPin);
+				}
+			}
+			PreviousThenPin = CachedOutput.SetNode->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output);
+
+			for (const TPair<UEdGraphPin*, UK2Node_VariableGet*>& Getter : CachedOutput.Getters)
+			{
+				CachedOutput.OutputPin->BreakLinkTo(Getter.Key);
+				Schema->TryCreateConnection(Getter.Value->FindPin(CachedOutput.VariableName, EGPD_Output), Getter.Key);
+			}
+
+			Schema->TryCreateConnection(CachedOutput.OutputPin, CachedOutput.SetNode->FindPin(CachedOutput.VariableName, EGPD_Input));
+		}
+
+		Schema->TryCreateConnection(PreviousThenPin, SinkExecPin);
+
+		// Clear the validator's warning, the node only runs once now
+		PureNode->bHasCompilerMessage = false;
+		PureNode->ErrorMsg.Empty();
+		Graph->NotifyGraphChanged();
+
+		return true;
+	}
+
+	// Walks the exec flow backwards, through collapsed graph boundaries, looking for a loop macro's LoopBody output
+	static bool IsInLoopBody(UEdGraphNode* Node)
+	{
+		static const FName LoopBodyPinName(TEXT("LoopBody"));
+
+		TSet<UEdGraphNode*> Visited = { Node };
+		TArray<UEdGraphNode*> Queue = { Node };
+		while (Queue.Num() > 0)
+		{
+			UEdGraphNode* Current = Queue.Pop();
+
+			// Entry tunnel of a collapsed graph, continue from whatever executes the collapsed node.
+			// Collapsed nodes and macro instances are tunnels too, those are walked through like any other node.
+			if (Current->GetClass() == UK2Node_Tunnel::StaticClass())
+			{
+				if (UK2Node_Composite* CompositeNode = Cast<UK2Node_Composite>(Current->GetGraph()->GetOuter()))
+				{
+					bool bAlreadyVisited = false;
+					Visited.Add(CompositeNode, &bAlreadyVisited);
+					if (!bAlreadyVisited)
+					{
+						Queue.Add(CompositeNode);
+					}
+				}
+				continue;
+			}
+
+			for (UEdGraphPin* Pin : Current->Pins)
+			{
+				if (Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec || Pin->Direction != EGPD_Input)
+				{
+					continue;
+				}
+
+				for (UEdGraphPin* Link : Pin->LinkedTo)
+				{
+					if (Link->PinName == LoopBodyPinName)
+					{
+						return true;
+					}
+
+					UEdGraphNode* Previous = Link->GetOwningNode();
+					bool bAlreadyVisited = false;
+					Visited.Add(Previous, &bAlreadyVisited);
+					if (!bAlreadyVisited)
+					{
+						Queue.Add(Previous);
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	template <typename NodeType>
+	static NodeType* SpawnNodeAt(UEdGraph* Graph, int32 PosX, int32 PosY)
+	{
+		FGraphNodeCreator<NodeType> NodeCreator(*Graph);
+		NodeType* Node = NodeCreator.CreateNode(false);
+		Node->NodePosX = PosX;
+		Node->NodePosY = PosY;
+		NodeCreator.Finalize();
+		return Node;
+	}
+
+	static bool ConvertBlockingLoadToAsync(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node, FText& OutFailureReason)
+	{
+		static const FName LoadClassAssetBlockingFunctionName(TEXT("LoadClassAsset_Blocking"));
+
+		if (!UEditorValidator_BlockingLoad::IsBlockingLoad(Node))
+		{
+			OutFailureReason = NSLOCTEXT("CommonValidators", "AsyncNotBlocking", "Node is not a blocking load.");
+			return false;
+		}
+
+		if (!UCommonValidatorsStatics::CanConvertBlockingLoadToAsync(Blueprint, Graph, Node, OutFailureReason))
+		{
+			return false;
+		}
+
+		const bool bIsClassLoad = CastChecked<UK2Node_CallFunction>(Node)->GetFunctionName() == LoadClassAssetBlockingFunctionName;
+		const FName InputPinName = bIsClassLoad ? TEXT("AssetClass") : TEXT("Asset");
+		const FName OutputPinName = bIsClassLoad ? TEXT("Class") : TEXT("Object");
+
+		UEdGraphPin* OldExecPin = Node->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input);
+		UEdGraphPin* OldThenPin = Node->FindPin(UEdGraphSchema_K2::PN_Then, EGPD_Output);
+		UEdGraphPin* OldInputPin = Node->FindPin(InputPinName, EGPD_Input);
+		UEdGraphPin* OldResultPin = Node->FindPin(UEdGraphSchema_K2::PN_ReturnValue, EGPD_Output);
+		if (!OldExecPin || !OldThenPin || !OldInputPin || !OldResultPin)
+		{
+			OutFailureReason = NSLOCTEXT("CommonValidators", "AsyncUnexpectedPins", "Blocking load node doesn't have the expected pins, refresh it first.");
+			return false;
+		}
+
+		Blueprint->Modify();
+		Graph->Modify();
+		Node->Modify();
+
+		UK2Node_LoadAsset* AsyncNode = bIsClassLoad
+			? SpawnNodeAt<UK2Node_LoadAssetClass>(Graph, Node->NodePosX, Node->NodePosY)
+			: SpawnNodeAt<UK2Node_LoadAsset>(Graph, Node->NodePosX, Node->NodePosY);
+
+		UEdGraphPin* NewExecPin = AsyncNode->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input);
+		UEdGraphPin* NewCompletedPin = AsyncNode->FindPin(UEdGraphSchema_K2::PN_Completed, EGPD_Output);
+		UEdGraphPin* NewInputPin = AsyncNode->FindPin(InputPinName, EGPD_Input);
+		UEdGraphPin* NewResultPin = AsyncNode->FindPin(OutputPinName, EGPD_Output);
+		if (!NewExecPin || !NewCompletedPin || !NewInputPin || !NewResultPin)
+		{
+			AsyncNode->DestroyNode();
+			OutFailureReason = NSLOCTEXT("CommonValidators", "AsyncNodeFailed", "Failed to create the async load node.");
+			return false;
+		}
+
+		// Everything that ran after the blocking load now runs once the load has completed
+		const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+		Schema->MovePinLinks(*OldExecPin, *NewExecPin);
+		Schema->MovePinLinks(*OldThenPin, *NewCompletedPin);
+		Schema->MovePinLinks(*OldInputPin, *NewInputPin);
+		Schema->MovePinLinks(*OldResultPin, *NewResultPin);
+
+		NewInputPin->DefaultValue = OldInputPin->DefaultValue;
+		NewInputPin->DefaultObject = OldInputPin->DefaultObject;
+
+		Node->DestroyNode();
+		Graph->NotifyGraphChanged();
+
+		return true;
+	}
+
+	static FAutoConsoleCommand CachePureNodeResultsCommand(
+		TEXT("CommonValidators.CachePureNodeResults"),
+		TEXT("Caches every multi-exec pure node result in a variable for all blueprints under a path. Usage: CommonValidators.CachePureNodeResults [/Game/Path]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			TArray<UBlueprint*> Blueprints;
+			UCommonValidatorsStatics::LoadBlueprintsUnderPath(Args.Num() > 0 ? Args[0] : TEXT("/Game"), Blueprints);
+
+			const int32 NumFixed = UCommonValidatorsStatics::CachePureNodeResultsInBlueprints(Blueprints);
+			UE_LOG(LogCommonValidators, Display, TEXT("Cached %d pure node results across %d blueprints."), NumFixed, Blueprints.Num());
+		}));
+
+	static FAutoConsoleCommand ConvertBlockingLoadsCommand(
+		TEXT("CommonValidators.ConvertBlockingLoadsToAsync"),
+		TEXT("Replaces blocking loads in event graphs with Async Load nodes for all blueprints under a path. Usage: CommonValidators.ConvertBlockingLoadsToAsync [/Game/Path]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			TArray<UBlueprint*> Blueprints;
+			UCommonValidatorsStatics::LoadBlueprintsUnderPath(Args.Num() > 0 ? Args[0] : TEXT("/Game"), Blueprints);
+
+			const int32 NumConverted = UCommonValidatorsStatics::ConvertBlockingLoadsToAsyncInBlueprints(Blueprints);
+			UE_LOG(LogCommonValidators, Display, TEXT("Converted %d blocking loads across %d blueprints."), NumConverted, Blueprints.Num());
+		}));
+} // namespace UE::Internal::CommonValidatorsStaticsHelpers
 
 
 void UCommonValidatorsStatics::OpenBlueprint(UBlueprint* Blueprint)
@@ -73,6 +588,179 @@ void UCommonValidatorsStatics::DeleteNodeFromBlueprint(UBlueprint* Blueprint, UE
     FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
 }
 
+bool UCommonValidatorsStatics::CachePureNodeResult(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node)
+{
+    if (!Blueprint || !Graph || !Node) return false;
+
+    // Begin a transaction for undo/redo support
+    FScopedTransaction Transaction(NSLOCTEXT("CommonValidators", "CachePureNodeResult", "Cache Pure Node Result"));
+
+    FText FailureReason;
+    if (!UE::Internal::CommonValidatorsStaticsHelpers::CachePureNodeResult(Blueprint, Graph, Node, FailureReason))
+    {
+        UE_LOG(LogCommonValidators, Warning, TEXT("Can't cache %s in %s: %s"), *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Blueprint->GetPathName(), *FailureReason.ToString());
+        Transaction.Cancel();
+        return false;
+    }
+
+    // New variables were added (will trigger recompilation)
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    return true;
+}
+
+int32 UCommonValidatorsStatics::CachePureNodeResultsInBlueprints(const TArray<UBlueprint*>& Blueprints)
+{
+    const FScopedTransaction Transaction(NSLOCTEXT("CommonValidators", "CachePureNodeResults", "Cache Pure Node Results"));
+
+    int32 NumFixed = 0;
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        if (!Blueprint) continue;
+
+        TArray<TPair<UEdGraph*, UK2Node_CallFunction*>> MultiExecNodes;
+        UEditorValidator_PureNode::FindMultiExecPureNodes(Blueprint, MultiExecNodes);
+
+        int32 NumFixedInBlueprint = 0;
+        for (const TPair<UEdGraph*, UK2Node_CallFunction*>& MultiExecNode : MultiExecNodes)
+        {
+            FText FailureReason;
+            if (UE::Internal::CommonValidatorsStaticsHelpers::CachePureNodeResult(Blueprint, MultiExecNode.Key, MultiExecNode.Value, FailureReason))
+            {
+                ++NumFixedInBlueprint;
+            }
+            else
+            {
+                UE_LOG(LogCommonValidators, Warning, TEXT("Can't cache %s in %s: %s"), *MultiExecNode.Value->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Blueprint->GetPathName(), *FailureReason.ToString());
+            }
+        }
+
+        if (NumFixedInBlueprint > 0)
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+            NumFixed += NumFixedInBlueprint;
+        }
+    }
+
+    return NumFixed;
+}
+
+bool UCommonValidatorsStatics::ConvertBlockingLoadToAsync(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node)
+{
+    if (!Blueprint || !Graph || !Node) return false;
+
+    // Begin a transaction for undo/redo support
+    FScopedTransaction Transaction(NSLOCTEXT("CommonValidators", "ConvertBlockingLoad", "Convert Blocking Load to Async"));
+
+    FText FailureReason;
+    if (!UE::Internal::CommonValidatorsStaticsHelpers::ConvertBlockingLoadToAsync(Blueprint, Graph, Node, FailureReason))
+    {
+        UE_LOG(LogCommonValidators, Warning, TEXT("Can't convert %s in %s: %s"), *Node->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Blueprint->GetPathName(), *FailureReason.ToString());
+        Transaction.Cancel();
+        return false;
+    }
+
+    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+    return true;
+}
+
+int32 UCommonValidatorsStatics::ConvertBlockingLoadsToAsyncInBlueprints(const TArray<UBlueprint*>& Blueprints)
+{
+    const FScopedTransaction Transaction(NSLOCTEXT("CommonValidators", "ConvertBlockingLoads", "Convert Blocking Loads to Async"));
+
+    int32 NumConverted = 0;
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        if (!Blueprint) continue;
+
+        // Collect first, converting destroys nodes. Collapsed graphs are part of their event graph.
+        TArray<UEdGraph*> EventGraphs;
+        for (UEdGraph* UbergraphPage : Blueprint->UbergraphPages)
+        {
+            EventGraphs.Add(UbergraphPage);
+            UbergraphPage->GetAllChildrenGraphs(EventGraphs);
+        }
+
+        TArray<TPair<UEdGraph*, UEdGraphNode*>> BlockingLoads;
+        for (UEdGraph* Graph : EventGraphs)
+        {
+            for (UEdGraphNode* Node : Graph->Nodes)
+            {
+                if (UEditorValidator_BlockingLoad::IsBlockingLoad(Node))
+                {
+                    BlockingLoads.Add({ Graph, Node });
+                }
+            }
+        }
+
+        int32 NumConvertedInBlueprint = 0;
+        for (const TPair<UEdGraph*, UEdGraphNode*>& BlockingLoad : BlockingLoads)
+        {
+            FText FailureReason;
+            if (UE::Internal::CommonValidatorsStaticsHelpers::ConvertBlockingLoadToAsync(Blueprint, BlockingLoad.Key, BlockingLoad.Value, FailureReason))
+            {
+                ++NumConvertedInBlueprint;
+            }
+            else
+            {
+                UE_LOG(LogCommonValidators, Warning, TEXT("Can't convert %s in %s: %s"), *BlockingLoad.Value->GetNodeTitle(ENodeTitleType::ListView).ToString(), *Blueprint->GetPathName(), *FailureReason.ToString());
+            }
+        }
+
+        if (NumConvertedInBlueprint > 0)
+        {
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+            NumConverted += NumConvertedInBlueprint;
+        }
+    }
+
+    return NumConverted;
+}
+
+int32 UCommonValidatorsStatics::ValidateBlueprintGraphsInParallel(const TArray<UBlueprint*>& Blueprints)
+{
+	return FBlueprintGraphAnalysis::ValidateBlueprintsInParallel(Blueprints);
+}
+
+bool UCommonValidatorsStatics::CanConvertBlockingLoadToAsync(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node, FText& OutFailureReason)
+{
+	// Collapsed graphs are expanded into their event graph when compiled
+	if (!Blueprint || !Graph || !Blueprint->UbergraphPages.Contains(FBlueprintEditorUtils::GetTopLevelGraph(Graph)))
+	{
+		OutFailureReason = NSLOCTEXT("CommonValidators", "AsyncNotEventGraph", "Can't convert automatically: Async Load is a latent node and latent nodes are only allowed in event graphs, not in functions or macros.");
+		return false;
+	}
+
+	if (Node && UE::Internal::CommonValidatorsStaticsHelpers::IsInLoopBody(Node))
+	{
+		OutFailureReason = NSLOCTEXT("CommonValidators", "AsyncInLoopBody", "Can't convert automatically: the node runs in a loop body, and a latent Async Load there would skip every iteration after the first. Load the assets before the loop instead.");
+		return false;
+	}
+
+	return true;
+}
+
+void UCommonValidatorsStatics::LoadBlueprintsUnderPath(const FString& PackagePath, TArray<UBlueprint*>& OutBlueprints)
+{
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(*PackagePath));
+	Filter.bRecursivePaths = true;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+
+	TArray<FAssetData> BlueprintAssets;
+	AssetRegistry.GetAssets(Filter, BlueprintAssets);
+
+	for (const FAssetData& BlueprintAsset : BlueprintAssets)
+	{
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(BlueprintAsset.GetAsset()))
+		{
+			OutBlueprints.Add(Blueprint);
+		}
+	}
+}
+
 bool UCommonValidatorsStatics::IsObjectAChildOf(const UObject* const AnyAssetReference, const TSubclassOf<UObject> ObjectClass)
 {
 	if (!IsValid(AnyAssetReference))
@@ -149,6 +837,27 @@ TSharedRef<FTokenizedMessage> UCommonValidatorsStatics::CreateLinkedMessage(cons
 	return TokenizedMessage;
 }
 
+TSharedRef<FTokenizedMessage> UCommonValidatorsStatics::CreateLinkedNodeMessage(const FAssetData& InAssetData, const FText& Text,
+	EMessageSeverity::Type Severity, UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node)
+{
+	TSharedRef<FTokenizedMessage> TokenizedMessage = CreateLinkedMessage(InAssetData, Text, Severity);
+
+	if (Blueprint && Graph && Node)
+	{
+		TokenizedMessage->AddToken(FActionToken::Create(
+			NSLOCTEXT("CommonValidators", "FocusNode", "Open Blueprint and Focus Node"),
+			NSLOCTEXT("CommonValidators", "FocusNodeTooltip", "Open this node in the Blueprint Editor"),
+			FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, Node]()
+			{
+				OpenBlueprintAndFocusNode(Blueprint, Graph, Node);
+			}),
+			false
+		));
+	}
+
+	return TokenizedMessage;
+}
+
 FAssetIdentifier UCommonValidatorsStatics::GetAssetIdentifierFromAssetData(const FAssetData& AssetData)
 {
 	// In the some MSVCs, RVO appears to only occur on the first instantiated return if the branches return
@@ -168,3 +877,15 @@ FAssetIdentifier UCommonValidatorsStatics::GetAssetIdentifierFromAssetData(const
 
 	return ReturnIdentifier;
 }
+
+FAssetData UCommonValidatorsStatics::GetMainAssetData(const IAssetRegistry& AssetRegistry, FName PackageName)
+{
+	const FString PackageNameString = PackageName.ToString();
+	if (PackageName == NAME_None || PackageNameString.StartsWith(TEXT("/Script/")))
+	{
+		return FAssetData();
+	}
+
+	const FString AssetPathString = PackageNameString + TEXT(".") + FPackageName::GetLongPackageAssetName(PackageNameString);
+	return AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPathString));
+}
@@ -6,6 +6,9 @@
 
 #include "CommonValidatorsStatics.generated.h"
 
+COMMONVALIDATORS_API DECLARE_LOG_CATEGORY_EXTERN(LogCommonValidators, Log, All);
+
+class IAssetRegistry;
 class UBlueprint;
 class UEdGraph;
 class UEdGraphNode;
@@ -26,6 +29,35 @@ public:
     UFUNCTION()
     static void DeleteNodeFromBlueprint(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node);
 
+	// Stores a multi-exec pure node's outputs in variables set once before its first exec sink, and rewires every consumer to getters.
+	// Local variables in functions, member variables in event graphs. One undoable transaction.
+	UFUNCTION()
+	static bool CachePureNodeResult(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node);
+
+	// Applies CachePureNodeResult to every multi-exec pure node in the given blueprints, as one transaction. Returns the number of nodes fixed.
+	UFUNCTION(BlueprintCallable, Category="Common Validators")
+	static int32 CachePureNodeResultsInBlueprints(const TArray<UBlueprint*>& Blueprints);
+
+	// Replaces a LoadAsset_Blocking/LoadClassAsset_Blocking node with the latent Async Load node, moving its exec continuation onto Completed
+	// and its result consumers onto the loaded object output. One undoable transaction. Refused outside event graphs.
+	UFUNCTION()
+	static bool ConvertBlockingLoadToAsync(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node);
+
+	// Applies ConvertBlockingLoadToAsync to every blocking load in the given blueprints' event graphs, as one transaction. Returns the number of nodes converted.
+	UFUNCTION(BlueprintCallable, Category="Common Validators")
+	static int32 ConvertBlockingLoadsToAsyncInBlueprints(const TArray<UBlueprint*>& Blueprints);
+
+	// Validates the given blueprints with the pure node, empty tick and blocking load checks run on worker threads up front.
+	// Returns the number of blueprints that failed validation plus the number of warnings.
+	UFUNCTION(BlueprintCallable, Category="Common Validators")
+	static int32 ValidateBlueprintGraphsInParallel(const TArray<UBlueprint*>& Blueprints);
+
+	// Latent nodes are only legal in event graphs, and a latent node in a loop body drops every iteration after the first
+	static bool CanConvertBlockingLoadToAsync(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node, FText& OutFailureReason);
+
+	// Loads every blueprint under a content path, e.g. /Game
+	static void LoadBlueprintsUnderPath(const FString& PackagePath, TArray<UBlueprint*>& OutBlueprints);
+
 	UFUNCTION()
 	static bool IsObjectAChildOf(const UObject* const AnyAssetReference, const TSubclassOf<UObject> ObjectClass);
 
@@ -34,5 +66,12 @@ public:
 	
 	static TSharedRef<FTokenizedMessage> CreateLinkedMessage(const FAssetData& InAssetData, const FText& Text, EMessageSeverity::Type Severity);
 
+	// CreateLinkedMessage with an action opening the blueprint on Node, left out when there is no node to focus
+	static TSharedRef<FTokenizedMessage> CreateLinkedNodeMessage(const FAssetData& InAssetData, const FText& Text, EMessageSeverity::Type Severity,
+		UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node);
+
 	static FAssetIdentifier GetAssetIdentifierFromAssetData(const FAssetData& AssetData);
+
+	// Looks up the asset named after its package (PackageName.PackageShortName). Code packages are never returned.
+	static FAssetData GetMainAssetData(const IAssetRegistry& AssetRegistry, FName PackageName);
 };
\ No newline at end of file
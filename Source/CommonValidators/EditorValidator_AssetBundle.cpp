@@ -0,0 +1,149 @@
+// This Header
+#include "EditorValidator_AssetBundle.h"
+
+// Unreal
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/AssetManager.h"
+#include "Engine/DataAsset.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDependencySnapshot.h"
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+#include "HeavyReferenceResidentBaseline.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_AssetBundle)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+namespace UE::Internal::AssetBundleValidatorHelpers
+{
+	static bool IncludeAll(int32)
+	{
+		return true;
+	}
+} // namespace UE::Internal::AssetBundleValidatorHelpers
+
+
+bool UEditorValidator_AssetBundle::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableAssetBundleValidator;
+	return bIsValidatorEnabled && InObject && InObject->IsA<UPrimaryDataAsset>();
+}
+
+EDataValidationResult UEditorValidator_AssetBundle::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	using namespace UE::Internal::AssetBundleValidatorHelpers;
+
+	if (!UAssetManager::IsInitialized()) return EDataValidationResult::NotValidated;
+
+	// Read from the asset's metadata rather than the asset manager's tables, the asset may not be saved or scanned yet
+	FAssetBundleData BundleData;
+	UAssetManager::Get().InitializeAssetBundlesFromMetadata(InAsset, BundleData);
+	if (BundleData.Bundles.IsEmpty()) return EDataValidationResult::Valid;
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	FCommonValidatorsDependencySnapshot& Snapshot = FCommonValidatorsDependencySnapshot::Get();
+	if (!Snapshot.EnsureReady(AssetRegistry)) return EDataValidationResult::NotValidated;
+
+	const FCommonValidatorsDependencyGraph& Graph = Snapshot.GetGraph();
+	const int32 RootIndex = Graph.FindPackageIndex(InAssetData.PackageName);
+	if (RootIndex == INDEX_NONE) return EDataValidationResult::NotValidated;
+
+	const UCommonValidatorsDeveloperSettings* DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnAssetBundles ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundIssue = false;
+
+	auto AddMessage = [&](const FText& Text)
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(InAssetData, Text, Severity));
+		bFoundIssue = true;
+	};
+
+	// Bundles are loaded on top of the primary asset, whose own closure and the resident content are already in memory
+	TBitArray<> AlreadyLoaded;
+	FHeavyReferenceResidentBaseline& ResidentBaseline = FHeavyReferenceResidentBaseline::Get();
+	if (DevSettings->bSubtractResidentBaseline && (ResidentBaseline.IsBuilt() || ResidentBaseline.Build(AssetRegistry)))
+	{
+		ResidentBaseline.CopyResidentPackages(AlreadyLoaded, Graph.Num());
+	}
+	else
+	{
+		AlreadyLoaded.Init(false, Graph.Num());
+	}
+	Graph.ComputeReachableSize(MakeArrayView(&RootIndex, 1), IncludeAll, AlreadyLoaded);
+
+	TBitArray<> AllBundlesLoaded = AlreadyLoaded;
+	uint64 AllBundlesSize = 0;
+
+	for (const FAssetBundleEntry& Bundle : BundleData.Bundles)
+	{
+		TArray<int32> Seeds;
+		for (const FTopLevelAssetPath& AssetPath : Bundle.AssetPaths)
+		{
+			const int32 AssetIndex = GetBundleAssetIndex(Graph, AssetPath);
+			if (AssetIndex != INDEX_NONE)
+			{
+				Seeds.AddUnique(AssetIndex);
+			}
+		}
+
+		TBitArray<> BundleLoaded = AlreadyLoaded;
+		const uint64 BundleSize = Graph.ComputeReachableSize(Seeds, IncludeAll, BundleLoaded);
+		AllBundlesSize += Graph.ComputeReachableSize(Seeds, IncludeAll, AllBundlesLoaded);
+
+		const int32* BundleBudget = DevSettings->AssetBundleBudgetsKiloBytes.Find(Bundle.BundleName);
+		const int64 BudgetBytes = static_cast<int64>(BundleBudget ? *BundleBudget : DevSettings->MaximumAssetBundleSizeKiloBytes) * 1024;
+		if (BudgetBytes <= 0 || BundleSize <= static_cast<uint64>(BudgetBytes))
+		{
+			continue;
+		}
+
+		// Each entry sized as if it were loaded alone, entries sharing content both count it
+		TArray<TPair<uint64, int32>> Contributors;
+		for (const int32 Seed : Seeds)
+		{
+			TBitArray<> EntryLoaded = AlreadyLoaded;
+			Contributors.Emplace(Graph.ComputeReachableSize(MakeArrayView(&Seed, 1), IncludeAll, EntryLoaded), Seed);
+		}
+		Contributors.Sort([](const TPair<uint64, int32>& A, const TPair<uint64, int32>& B) { return A.Key > B.Key; });
+
+		TArray<FString> ContributorStrings;
+		for (int32 ContributorIndex = 0; ContributorIndex < FMath::Min(Contributors.Num(), DevSettings->MaximumReportedAssetBundleContributors); ++ContributorIndex)
+		{
+			ContributorStrings.Add(FString::Printf(TEXT("%s (%s)"),
+				*Graph.GetPackageName(Contributors[ContributorIndex].Value).ToString(),
+				*FText::AsMemory(Contributors[ContributorIndex].Key).ToString()));
+		}
+
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.AssetBundle.Bundle", "Asset bundle {0} loads {1} on top of the asset, the budget is {2}. Largest entries: {3}"),
+			FText::FromName(Bundle.BundleName),
+			FText::AsMemory(BundleSize),
+			FText::AsMemory(BudgetBytes),
+			FText::FromString(FString::Join(ContributorStrings, TEXT(", ")))));
+	}
+
+	const int64 TotalBudgetBytes = static_cast<int64>(DevSettings->MaximumAssetBundlesTotalSizeKiloBytes) * 1024;
+	if (TotalBudgetBytes > 0 && AllBundlesSize > static_cast<uint64>(TotalBudgetBytes))
+	{
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.AssetBundle.Total", "The {0} asset bundles load {1} together on top of the asset, the budget is {2}."),
+			BundleData.Bundles.Num(),
+			FText::AsMemory(AllBundlesSize),
+			FText::AsMemory(TotalBudgetBytes)));
+	}
+
+	return (bFoundIssue && DevSettings->bErrorOnAssetBundles) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+int32 UEditorValidator_AssetBundle::GetBundleAssetIndex(const FCommonValidatorsDependencyGraph& Graph, const FTopLevelAssetPath& AssetPath)
+{
+	return AssetPath.IsValid() ? Graph.FindPackageIndex(AssetPath.GetPackageName()) : INDEX_NONE;
+}
+
+#undef LOCTEXT_NAMESPACE
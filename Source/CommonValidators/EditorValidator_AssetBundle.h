@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_AssetBundle.generated.h"
+
+struct FTopLevelAssetPath;
+class FCommonValidatorsDependencyGraph;
+
+/**
+ * Sizes what each asset bundle of a primary data asset loads: the hard closure of the bundle's assets, on top of the
+ * primary asset's own closure and the resident baseline. Each bundle is checked against its own budget, all bundles
+ * together against a total budget with shared content counted once, and the largest entries of a bundle over budget are listed.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_AssetBundle : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+public:
+	// Graph index of the package holding a bundle asset, INDEX_NONE for assets outside the graph such as native classes
+	static int32 GetBundleAssetIndex(const FCommonValidatorsDependencyGraph& Graph, const FTopLevelAssetPath& AssetPath);
+};
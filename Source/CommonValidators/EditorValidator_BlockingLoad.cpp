@@ -11,6 +11,7 @@
 #include "CommonValidatorsStatics.h"
 #include "K2Node_CallFunction.h"
 #include "CommonValidatorsDeveloperSettings.h"
+#include "BlueprintGraphSnapshot.h"
 
 
 bool UEditorValidator_BlockingLoad::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
@@ -26,36 +27,24 @@ EDataValidationResult UEditorValidator_BlockingLoad::ValidateLoadedAsset_Impleme
 
 	EDataValidationResult DataValidationResult = EDataValidationResult::Valid;
 
-	TArray<UEdGraph*> AllGraphs;
-	AllGraphs.Append(Blueprint->FunctionGraphs);
-	AllGraphs.Append(Blueprint->UbergraphPages);
-	
-    for (UEdGraph* Graph : AllGraphs)
+	// Shared with the other graph validators of the validation pass
+	const TSharedRef<const FBlueprintGraphAnalysisCache::FEntry> Analysis = FBlueprintGraphAnalysisCache::Get().FindOrAnalyze(Blueprint);
+	const FBlueprintGraphSnapshot& Snapshot = Analysis->Snapshot;
+	const FBlueprintGraphSnapshotSource& Source = Analysis->Source;
+
+	for (int32 NodeIndex : Analysis->Result.BlockingLoads)
 	{
-		for (UEdGraphNode* Node : Graph->Nodes)
+		UEdGraph* Graph = Source.Graphs[Snapshot.Nodes[NodeIndex].Graph].Get();
+		UEdGraphNode* Node = Source.Nodes[NodeIndex].Get();
+		if (!Graph || !Node)
 		{
-			if (IsBlockingLoad(Node))
-			{
-				bool bShouldError = GetDefault<UCommonValidatorsDeveloperSettings>()->bErrorBlockingLoad;
-
-				// Create a tokenized message with an action to open the Blueprint and focus the node
-				TSharedRef<FTokenizedMessage> TokenizedMessage = FTokenizedMessage::Create((bShouldError ? EMessageSeverity::Error : EMessageSeverity::Warning), FText::FromString(TEXT("Blocking (synchronous) loading nodes found.")));
-
-				TokenizedMessage->AddToken(FActionToken::Create(
-					FText::FromString(TEXT("Open Blueprint and Focus Node")),
-					FText::FromString(TEXT("Open Blueprint and Focus Node")),
-					FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, Node]()
-						{
-							UCommonValidatorsStatics::OpenBlueprintAndFocusNode(Blueprint, Graph, Node);
-						}),
-					false
-				));
+			continue;
+		}
 
-				Context.AddMessage(TokenizedMessage);
+		Context.AddMessage(CreateBlockingLoadMessage(Blueprint, Graph, Node));
 
-				DataValidationResult = bShouldError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
-			}
-		}
+		bool bShouldError = GetDefault<UCommonValidatorsDeveloperSettings>()->bErrorBlockingLoad;
+		DataValidationResult = bShouldError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 	}
 
 	return DataValidationResult;
@@ -71,21 +60,45 @@ bool UEditorValidator_BlockingLoad::IsBlockingLoad(UEdGraphNode* Node)
 		return false;
 	}
 
-	static const FName LoadAssetBlockingFunctionName(TEXT("LoadAsset_Blocking"));
-	static const FName LoadClassAssetBlockingFunctionName(TEXT("LoadClassAsset_Blocking"));
-	FName FunctionName = CallFunctionNode->GetFunctionName();
+	return FBlueprintGraphAnalysis::IsBlockingLoadFunction(CallFunctionNode->GetFunctionName());
+}
 
-	if (FunctionName == LoadAssetBlockingFunctionName)
+TSharedRef<FTokenizedMessage> UEditorValidator_BlockingLoad::CreateBlockingLoadMessage(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node)
+{
+	bool bShouldError = GetDefault<UCommonValidatorsDeveloperSettings>()->bErrorBlockingLoad;
+
+	// Create a tokenized message with an action to open the Blueprint and focus the node
+	TSharedRef<FTokenizedMessage> TokenizedMessage = FTokenizedMessage::Create((bShouldError ? EMessageSeverity::Error : EMessageSeverity::Warning), FText::FromString(TEXT("Blocking (synchronous) loading nodes found.")));
+
+	TokenizedMessage->AddToken(FActionToken::Create(
+		FText::FromString(TEXT("Open Blueprint and Focus Node")),
+		FText::FromString(TEXT("Open Blueprint and Focus Node")),
+		FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, Node]()
+			{
+				UCommonValidatorsStatics::OpenBlueprintAndFocusNode(Blueprint, Graph, Node);
+			}),
+		false
+	));
+
+	// Latent nodes only work in event graphs and outside of loops, explain instead of offering a fix that would be refused
+	FText ConvertFailureReason;
+	if (UCommonValidatorsStatics::CanConvertBlockingLoadToAsync(Blueprint, Graph, Node, ConvertFailureReason))
 	{
-		return true;
+		TokenizedMessage->AddToken(FActionToken::Create(
+			NSLOCTEXT("CommonValidators", "ConvertToAsyncLoad", "Convert to Async Load"),
+			NSLOCTEXT("CommonValidators", "ConvertToAsyncLoadTooltip", "Replace this node with an Async Load Asset node and move everything after it onto Completed"),
+			FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, Node]()
+				{
+					UCommonValidatorsStatics::ConvertBlockingLoadToAsync(Blueprint, Graph, Node);
+				}),
+			// The node is destroyed by the conversion
+			/*bInSingleUse=*/true
+		));
 	}
-
-	if (FunctionName == LoadClassAssetBlockingFunctionName)
+	else
 	{
-		return true;
+		TokenizedMessage->AddToken(FTextToken::Create(ConvertFailureReason));
 	}
 
-
-	// Not a blocking (synchronous) loading function
-	return false;
+	return TokenizedMessage;
 }
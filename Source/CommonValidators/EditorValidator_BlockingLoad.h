@@ -4,6 +4,10 @@
 #include "EditorValidatorBase.h"
 #include "EditorValidator_BlockingLoad.generated.h"
 
+class UBlueprint;
+class UEdGraph;
+class FTokenizedMessage;
+
 UCLASS()
 class COMMONVALIDATORS_API UEditorValidator_BlockingLoad : public UEditorValidatorBase
 {
@@ -12,5 +16,9 @@ class COMMONVALIDATORS_API UEditorValidator_BlockingLoad : public UEditorValidat
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 
-	bool IsBlockingLoad(class UEdGraphNode* Node);
+public:
+	static bool IsBlockingLoad(class UEdGraphNode* Node);
+
+	// Message with focus and, where possible, convert actions for a node found by IsBlockingLoad
+	static TSharedRef<FTokenizedMessage> CreateBlockingLoadMessage(UBlueprint* Blueprint, UEdGraph* Graph, UEdGraphNode* Node);
 };
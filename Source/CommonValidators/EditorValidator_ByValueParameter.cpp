@@ -0,0 +1,338 @@
+// This Header
+#include "EditorValidator_ByValueParameter.h"
+
+// Unreal
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallDelegate.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
+#include "K2Node_MacroInstance.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_ByValueParameter)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+namespace UE::Internal::ByValueParameterValidatorHelpers
+{
+	// Containers of structs holding containers of structs... are only followed this deep
+	static constexpr int32 MaximumNestingDepth = 4;
+
+	// Pure nodes feeding a hot node are evaluated with it, followed this many links back
+	static constexpr int32 MaximumPureInputDepth = 8;
+
+	static int64 EstimateCopySize(const FProperty* Property, int32 AssumedContainerElements, int32 Depth)
+	{
+		int64 Size = Property->GetSize();
+		if (Depth >= MaximumNestingDepth)
+		{
+			return Size;
+		}
+
+		// Heap allocations of containers are copied along with the container itself
+		if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			Size += AssumedContainerElements * EstimateCopySize(ArrayProperty->Inner, AssumedContainerElements, Depth + 1);
+		}
+		else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+		{
+			Size += AssumedContainerElements * EstimateCopySize(SetProperty->ElementProp, AssumedContainerElements, Depth + 1);
+		}
+		else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+		{
+			Size += AssumedContainerElements * (EstimateCopySize(MapProperty->KeyProp, AssumedContainerElements, Depth + 1) + EstimateCopySize(MapProperty->ValueProp, AssumedContainerElements, Depth + 1));
+		}
+		else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			// Inline members are part of the struct size already, only add what they allocate
+			for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+			{
+				Size += EstimateCopySize(*It, AssumedContainerElements, Depth + 1) - It->GetSize();
+			}
+		}
+
+		return Size;
+	}
+
+	static bool IsLoopMacro(const UEdGraphNode* Node)
+	{
+		const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node);
+		const UEdGraph* MacroGraph = MacroNode ? MacroNode->GetMacroGraph() : nullptr;
+		return MacroGraph && MacroGraph->GetName().Contains(TEXT("Loop"));
+	}
+
+	struct FHotPathWalker
+	{
+		TMap<FName, UEdGraph*> FunctionGraphs;
+		TMap<FName, FName>* HotFunctions = nullptr;
+		TArray<UEdGraph*> PendingHotGraphs;
+		TSet<TPair<UEdGraphNode*, bool>> Visited;
+
+		void MarkHot(FName FunctionName, const UEdGraph* FromGraph)
+		{
+			if (HotFunctions->Contains(FunctionName))
+			{
+				return;
+			}
+
+			HotFunctions->Add(FunctionName, FromGraph->GetFName());
+			if (UEdGraph** FunctionGraph = FunctionGraphs.Find(FunctionName))
+			{
+				PendingHotGraphs.Add(*FunctionGraph);
+			}
+		}
+
+		// Calls made by a node on a hot path, and by the pure nodes it evaluates
+		void MarkCalls(const UEdGraphNode* Node, const UEdGraph* Graph, int32 Depth)
+		{
+			if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+			{
+				if (CallNode->FunctionReference.IsSelfContext())
+				{
+					MarkHot(CallNode->GetFunctionName(), Graph);
+				}
+			}
+			else if (const UK2Node_CallDelegate* DelegateNode = Cast<UK2Node_CallDelegate>(Node))
+			{
+				MarkHot(DelegateNode->GetPropertyName(), Graph);
+			}
+
+			if (Depth >= MaximumPureInputDepth)
+			{
+				return;
+			}
+
+			for (const UEdGraphPin* Pin : Node->Pins)
+			{
+				if (!Pin || Pin->Direction != EGPD_Input || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+				{
+					continue;
+				}
+
+				for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					const UK2Node* LinkedNode = LinkedPin ? Cast<UK2Node>(LinkedPin->GetOwningNode()) : nullptr;
+					if (LinkedNode && LinkedNode->IsNodePure())
+					{
+						MarkCalls(LinkedNode, Graph, Depth + 1);
+					}
+				}
+			}
+		}
+
+		// Follows exec links, everything after a Tick event or inside a loop body is hot
+		void Walk(UEdGraphNode* Start, bool bStartHot)
+		{
+			TArray<TPair<UEdGraphNode*, bool>> Stack = { { Start, bStartHot } };
+			while (!Stack.IsEmpty())
+			{
+				const TPair<UEdGraphNode*, bool> Current = Stack.Pop();
+
+				bool bAlreadyVisited = false;
+				Visited.Add(Current, &bAlreadyVisited);
+				if (bAlreadyVisited)
+				{
+					continue;
+				}
+
+				UEdGraphNode* Node = Current.Key;
+				const bool bIsHot = Current.Value;
+				if (bIsHot)
+				{
+					MarkCalls(Node, Node->GetGraph(), 0);
+				}
+
+				const bool bIsLoop = IsLoopMacro(Node);
+				for (const UEdGraphPin* Pin : Node->Pins)
+				{
+					if (!Pin || Pin->Direction != EGPD_Output || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+					{
+						continue;
+					}
+
+					const bool bIsLoopBody = bIsLoop && Pin->PinName == TEXT("LoopBody");
+					for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+					{
+						if (LinkedPin && LinkedPin->GetOwningNode())
+						{
+							Stack.Add({ LinkedPin->GetOwningNode(), bIsHot || bIsLoopBody });
+						}
+					}
+				}
+			}
+		}
+	};
+
+	template <typename NodeType>
+	static NodeType* FindNode(UEdGraph* Graph)
+	{
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (NodeType* TypedNode = Cast<NodeType>(Node))
+			{
+				return TypedNode;
+			}
+		}
+		return nullptr;
+	}
+} // namespace UE::Internal::ByValueParameterValidatorHelpers
+
+
+bool UEditorValidator_ByValueParameter::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableByValueParameterValidator;
+	return bIsValidatorEnabled && InObject && InObject->IsA<UBlueprint>();
+}
+
+EDataValidationResult UEditorValidator_ByValueParameter::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	using namespace UE::Internal::ByValueParameterValidatorHelpers;
+
+	UBlueprint* Blueprint = Cast<UBlueprint>(InAsset);
+	if (!Blueprint) return EDataValidationResult::NotValidated;
+
+	// Parameters are read from the skeleton class, it is up to date without a full compile
+	UClass* SkeletonClass = Blueprint->SkeletonGeneratedClass;
+	if (!SkeletonClass)
+	{
+		return EDataValidationResult::NotValidated;
+	}
+
+	const UCommonValidatorsDeveloperSettings* DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	const EMessageSeverity::Type HotSeverity = DevSettings->bErrorOnHotByValueParameters ? EMessageSeverity::Error : EMessageSeverity::Warning;
+	bool bFoundError = false;
+
+	TMap<FName, FName> HotFunctions;
+	FindHotFunctions(Blueprint, HotFunctions);
+
+	// Interface blueprints keep their signatures in FunctionGraphs too
+	TArray<TPair<UEdGraph*, UFunction*>> Signatures;
+	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (UFunction* Function = Graph ? SkeletonClass->FindFunctionByName(Graph->GetFName()) : nullptr)
+		{
+			Signatures.Add({ Graph, Function });
+		}
+	}
+	for (UEdGraph* Graph : Blueprint->DelegateSignatureGraphs)
+	{
+		if (UFunction* Function = Graph ? SkeletonClass->FindFunctionByName(*(Graph->GetName() + HEADER_GENERATED_DELEGATE_SIGNATURE_SUFFIX)) : nullptr)
+		{
+			Signatures.Add({ Graph, Function });
+		}
+	}
+
+	for (const TPair<UEdGraph*, UFunction*>& Signature : Signatures)
+	{
+		UEdGraph* Graph = Signature.Key;
+		const FName* HotCaller = HotFunctions.Find(Graph->GetFName());
+
+		for (TFieldIterator<FProperty> It(Signature.Value); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+		{
+			const FProperty* Parameter = *It;
+			const bool bIsContainerOrStruct = Parameter->IsA<FStructProperty>() || Parameter->IsA<FArrayProperty>() || Parameter->IsA<FSetProperty>() || Parameter->IsA<FMapProperty>();
+			if (!bIsContainerOrStruct || Parameter->HasAnyPropertyFlags(CPF_ReferenceParm))
+			{
+				continue;
+			}
+
+			const int64 CopySize = EstimateCopySize(Parameter, DevSettings->ByValueParameterAssumedContainerElements);
+			if (CopySize <= DevSettings->MaximumByValueParameterBytes)
+			{
+				continue;
+			}
+
+			const bool bIsOutput = Parameter->HasAnyPropertyFlags(CPF_OutParm | CPF_ReturnParm);
+			FText Text = FText::Format(bIsOutput
+					? LOCTEXT("CommonValidators.ByValueParameter.Output", "{0} output {1} ({2}) copies about {3} on every return. Return something smaller, or modify a Pass-by-Reference input instead.")
+					: LOCTEXT("CommonValidators.ByValueParameter.Input", "{0} input {1} ({2}) copies about {3} on every call. Mark it Pass-by-Reference."),
+				FText::FromName(Graph->GetFName()),
+				FText::FromString(Parameter->GetAuthoredName()),
+				UEdGraphSchema_K2::TypeToText(Parameter),
+				FText::AsMemory(CopySize));
+
+			if (HotCaller)
+			{
+				Text = FText::Format(LOCTEXT("CommonValidators.ByValueParameter.Hot", "{0} It is called every frame or inside a loop from {1}."), Text, FText::FromName(*HotCaller));
+			}
+
+			// Inputs live on the entry node, outputs on the result node
+			UEdGraphNode* FocusNode = bIsOutput ? static_cast<UEdGraphNode*>(FindNode<UK2Node_FunctionResult>(Graph)) : static_cast<UEdGraphNode*>(FindNode<UK2Node_FunctionEntry>(Graph));
+
+			const EMessageSeverity::Type Severity = HotCaller ? HotSeverity : EMessageSeverity::PerformanceWarning;
+			Context.AddMessage(UCommonValidatorsStatics::CreateLinkedNodeMessage(InAssetData, Text, Severity, Blueprint, Graph, FocusNode));
+
+			bFoundError |= Severity == EMessageSeverity::Error;
+		}
+	}
+
+	return bFoundError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+int64 UEditorValidator_ByValueParameter::EstimateCopySize(const FProperty* Property, int32 AssumedContainerElements)
+{
+	return UE::Internal::ByValueParameterValidatorHelpers::EstimateCopySize(Property, AssumedContainerElements, 0);
+}
+
+void UEditorValidator_ByValueParameter::FindHotFunctions(UBlueprint* Blueprint, TMap<FName, FName>& OutHotFunctions)
+{
+	using namespace UE::Internal::ByValueParameterValidatorHelpers;
+
+	static const FName ReceiveTickName(TEXT("ReceiveTick"));
+	static const FName WidgetTickName(TEXT("Tick"));
+
+	FHotPathWalker Walker;
+	Walker.HotFunctions = &OutHotFunctions;
+	for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		if (Graph)
+		{
+			Walker.FunctionGraphs.Add(Graph->GetFName(), Graph);
+		}
+	}
+
+	for (UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+			{
+				const FName EventName = EventNode->EventReference.GetMemberName();
+				Walker.Walk(Node, EventName == ReceiveTickName || EventName == WidgetTickName);
+			}
+		}
+	}
+
+	// Loops inside functions
+	for (const TPair<FName, UEdGraph*>& FunctionGraph : Walker.FunctionGraphs)
+	{
+		if (UK2Node_FunctionEntry* EntryNode = FindNode<UK2Node_FunctionEntry>(FunctionGraph.Value))
+		{
+			Walker.Walk(EntryNode, false);
+		}
+	}
+
+	// Everything a hot function calls is hot too
+	while (!Walker.PendingHotGraphs.IsEmpty())
+	{
+		if (UK2Node_FunctionEntry* EntryNode = FindNode<UK2Node_FunctionEntry>(Walker.PendingHotGraphs.Pop()))
+		{
+			Walker.Walk(EntryNode, true);
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_ByValueParameter.generated.h"
+
+class FProperty;
+class UBlueprint;
+
+/**
+ * Flags struct and container parameters of blueprint functions, event dispatchers and interface functions that are
+ * copied on every call because they aren't passed by reference. Copy sizes are estimated from the parameter properties.
+ * Functions this blueprint calls from Tick or from a loop body, directly or through other functions, are reported with a higher severity.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_ByValueParameter : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+public:
+	// Bytes copied when passing the property by value, including the contents of containers at AssumedContainerElements each
+	static int64 EstimateCopySize(const FProperty* Property, int32 AssumedContainerElements);
+
+	// Functions and event dispatchers of the blueprint called from Tick or inside a loop body, with the graph of the first such call
+	static void FindHotFunctions(UBlueprint* Blueprint, TMap<FName, FName>& OutHotFunctions);
+};
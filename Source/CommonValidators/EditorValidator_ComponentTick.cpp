@@ -0,0 +1,250 @@
+// This Header
+#include "EditorValidator_ComponentTick.h"
+
+// Unreal
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "GameFramework/Actor.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_ComponentTick)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+bool UEditorValidator_ComponentTick::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableComponentTickValidator;
+	const UBlueprint* Blueprint = Cast<UBlueprint>(InObject);
+	if (!bIsValidatorEnabled || !Blueprint || !Blueprint->GeneratedClass)
+	{
+		return false;
+	}
+
+	return Blueprint->GeneratedClass->IsChildOf<AActor>() || Blueprint->GeneratedClass->IsChildOf<UActorComponent>();
+}
+
+EDataValidationResult UEditorValidator_ComponentTick::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const UCommonValidatorsDeveloperSettings* const DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+
+	UBlueprint* Blueprint = Cast<UBlueprint>(InAsset);
+	if (!IsValid(Blueprint) || !Blueprint->GeneratedClass)
+	{
+		return EDataValidationResult::NotValidated;
+	}
+
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnComponentTick ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundIssue = false;
+
+	auto AddMessage = [&](const FText& Text)
+	{
+		TSharedRef<FTokenizedMessage> TokenizedMessage = UCommonValidatorsStatics::CreateLinkedMessage(InAssetData, Text, Severity);
+		TokenizedMessage->AddToken(FActionToken::Create(
+			LOCTEXT("CommonValidators.ComponentTick.OpenBlueprint", "Open Blueprint"),
+			LOCTEXT("CommonValidators.ComponentTick.OpenBlueprintTooltip", "Open this Blueprint in the Blueprint Editor"),
+			FOnActionTokenExecuted::CreateLambda([Blueprint]()
+				{
+					UCommonValidatorsStatics::OpenBlueprint(Blueprint);
+				}),
+			false
+		));
+
+		Context.AddMessage(TokenizedMessage);
+		bFoundIssue = true;
+	};
+
+	// The blueprint itself, actor or component
+	const UObject* const ClassDefaultObject = Blueprint->GeneratedClass->GetDefaultObject();
+	if (CanEverTick(ClassDefaultObject) && !HasTickImplementation(Blueprint->GeneratedClass))
+	{
+		AddMessage(LOCTEXT("CommonValidators.ComponentTick.SelfTick", "Tick is enabled (bCanEverTick) but nothing implements it. Disable Start With Tick Enabled / Can Ever Tick in the Class Defaults."));
+	}
+
+	// Component templates only exist on actors
+	if (!Blueprint->GeneratedClass->IsChildOf<AActor>())
+	{
+		return (bFoundIssue && DevSettings->bErrorOnComponentTick) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+	}
+
+	TArray<FComponentEntry> Components;
+	GatherComponents(Blueprint, Components);
+
+	for (const FComponentEntry& Component : Components)
+	{
+		if (CanEverTick(Component.Template) && !HasTickImplementation(Component.Template->GetClass()))
+		{
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.ComponentTick.ComponentTick", "Component {0} ({1}) can tick but its class has no tick logic. Disable Can Ever Tick on the component."),
+				FText::FromName(Component.Name),
+				FText::FromString(Component.Template->GetClass()->GetName())));
+		}
+	}
+
+	if (DevSettings->MaximumComponentCount > 0 && Components.Num() > DevSettings->MaximumComponentCount)
+	{
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.ComponentTick.ComponentCount", "Actor has {0} components, the budget is {1}."),
+			Components.Num(),
+			DevSettings->MaximumComponentCount));
+	}
+
+	if (DevSettings->MaximumSceneComponentDepth > 0)
+	{
+		TMap<FName, int32> DepthCache;
+		int32 DeepestIndex = INDEX_NONE;
+		int32 DeepestDepth = 0;
+		for (int32 Index = 0; Index < Components.Num(); ++Index)
+		{
+			const int32 Depth = GetSceneDepth(Components, Index, DepthCache);
+			if (Depth > DeepestDepth)
+			{
+				DeepestDepth = Depth;
+				DeepestIndex = Index;
+			}
+		}
+
+		if (DeepestDepth > DevSettings->MaximumSceneComponentDepth)
+		{
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.ComponentTick.SceneDepth", "Scene component hierarchy is {0} levels deep at {1}, the budget is {2}. Every level adds transform update cost."),
+				DeepestDepth,
+				FText::FromName(Components[DeepestIndex].Name),
+				DevSettings->MaximumSceneComponentDepth));
+		}
+	}
+
+	return (bFoundIssue && DevSettings->bErrorOnComponentTick) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+void UEditorValidator_ComponentTick::GatherComponents(UBlueprint* Blueprint, TArray<FComponentEntry>& OutComponents) const
+{
+	UBlueprintGeneratedClass* GeneratedClass = Cast<UBlueprintGeneratedClass>(Blueprint->GeneratedClass);
+	if (!GeneratedClass)
+	{
+		return;
+	}
+
+	// Native components are default subobjects of the CDO, their attachment is set up in the native constructor
+	const AActor* const ActorCDO = Cast<AActor>(GeneratedClass->GetDefaultObject());
+	if (ActorCDO)
+	{
+		TInlineComponentArray<UActorComponent*> NativeComponents;
+		ActorCDO->GetComponents(NativeComponents);
+		for (const UActorComponent* NativeComponent : NativeComponents)
+		{
+			const USceneComponent* SceneComponent = Cast<USceneComponent>(NativeComponent);
+			const USceneComponent* AttachParent = SceneComponent ? SceneComponent->GetAttachParent() : nullptr;
+			OutComponents.Add({ NativeComponent->GetFName(), AttachParent ? AttachParent->GetFName() : NAME_None, NativeComponent });
+		}
+	}
+
+	// Components added in this blueprint and every blueprint parent
+	TArray<const UBlueprintGeneratedClass*> BlueprintClasses;
+	UBlueprintGeneratedClass::GetGeneratedClassesHierarchy(GeneratedClass, BlueprintClasses);
+	for (const UBlueprintGeneratedClass* BlueprintClass : BlueprintClasses)
+	{
+		if (!BlueprintClass->SimpleConstructionScript)
+		{
+			continue;
+		}
+
+		for (USCS_Node* Node : BlueprintClass->SimpleConstructionScript->GetAllNodes())
+		{
+			// Use our own override of inherited templates, that's what will actually be spawned
+			const UActorComponent* Template = Node ? Node->GetActualComponentTemplate(GeneratedClass) : nullptr;
+			if (!Template)
+			{
+				continue;
+			}
+
+			FName ParentName = Node->ParentComponentOrVariableName;
+			if (const USCS_Node* ParentNode = BlueprintClass->SimpleConstructionScript->FindParentNode(Node))
+			{
+				ParentName = ParentNode->GetVariableName();
+			}
+
+			OutComponents.Add({ Node->GetVariableName(), ParentName, Template });
+		}
+	}
+}
+
+int32 UEditorValidator_ComponentTick::GetSceneDepth(const TArray<FComponentEntry>& Components, int32 ComponentIndex, TMap<FName, int32>& DepthCache) const
+{
+	const FComponentEntry& Entry = Components[ComponentIndex];
+	if (!Entry.Template->IsA<USceneComponent>())
+	{
+		return 0;
+	}
+
+	if (const int32* CachedDepth = DepthCache.Find(Entry.Name))
+	{
+		return *CachedDepth;
+	}
+
+	// Guard against malformed (cyclic) attachment data while we recurse
+	DepthCache.Add(Entry.Name, 1);
+
+	int32 Depth = 1;
+	if (Entry.ParentName != NAME_None)
+	{
+		const int32 ParentIndex = Components.IndexOfByPredicate([&Entry](const FComponentEntry& Other) { return Other.Name == Entry.ParentName; });
+		if (ParentIndex != INDEX_NONE)
+		{
+			Depth += GetSceneDepth(Components, ParentIndex, DepthCache);
+		}
+	}
+
+	DepthCache.Add(Entry.Name, Depth);
+	return Depth;
+}
+
+bool UEditorValidator_ComponentTick::CanEverTick(const UObject* TickingObject)
+{
+	if (const AActor* Actor = Cast<AActor>(TickingObject))
+	{
+		return Actor->PrimaryActorTick.bCanEverTick;
+	}
+
+	if (const UActorComponent* Component = Cast<UActorComponent>(TickingObject))
+	{
+		return Component->PrimaryComponentTick.bCanEverTick;
+	}
+
+	return false;
+}
+
+bool UEditorValidator_ComponentTick::HasTickImplementation(const UClass* ObjectClass)
+{
+	static const FName ReceiveTickName(TEXT("ReceiveTick"));
+
+	if (!ObjectClass)
+	{
+		return false;
+	}
+
+	// A blueprint Event Tick shows up as an override of ReceiveTick on a generated class
+	const UFunction* TickFunction = ObjectClass->FindFunctionByName(ReceiveTickName);
+	if (TickFunction && Cast<UBlueprintGeneratedClass>(TickFunction->GetOuterUClass()))
+	{
+		return true;
+	}
+
+	// We can't see native Tick overrides through reflection.
+	// Native classes that tick enable it in their constructor, so trust the native CDO.
+	const UClass* const NativeClass = FBlueprintEditorUtils::FindFirstNativeClass(const_cast<UClass*>(ObjectClass));
+	return NativeClass && CanEverTick(NativeClass->GetDefaultObject());
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_ComponentTick.generated.h"
+
+class UActorComponent;
+class UBlueprint;
+
+/**
+ * Validates the tick settings and component layout of actor and component blueprints.
+ * Flags anything that can tick without having tick logic, deep scene component hierarchies
+ * and component counts above the configured budget.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_ComponentTick : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+private:
+	struct FComponentEntry
+	{
+		FName Name;
+		FName ParentName;
+		const UActorComponent* Template = nullptr;
+	};
+
+	void GatherComponents(UBlueprint* Blueprint, TArray<FComponentEntry>& OutComponents) const;
+	int32 GetSceneDepth(const TArray<FComponentEntry>& Components, int32 ComponentIndex, TMap<FName, int32>& DepthCache) const;
+
+	static bool CanEverTick(const UObject* TickingObject);
+	static bool HasTickImplementation(const UClass* ObjectClass);
+};
@@ -0,0 +1,392 @@
+// This Header
+#include "EditorValidator_ConstructionScript.h"
+
+// Unreal
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_AddComponent.h"
+#include "K2Node_AddComponentByClass.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Composite.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_SpawnActorFromClass.h"
+#include "K2Node_Tunnel.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "BlueprintGraphSnapshot.h"
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_ConstructionScript)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+namespace UE::Internal::ConstructionScriptValidatorHelpers
+{
+	using FCostEstimate = UEditorValidator_ConstructionScript::FCostEstimate;
+	using FCostNode = UEditorValidator_ConstructionScript::FCostNode;
+
+	// Loops nested deeper than this aren't multiplied again, also stops exec wires looping back into a loop
+	static constexpr int32 MaximumLoopNesting = 4;
+
+	static bool IsLoopMacro(const UEdGraphNode* Node)
+	{
+		const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node);
+		const UEdGraph* MacroGraph = MacroNode ? MacroNode->GetMacroGraph() : nullptr;
+		return MacroGraph && MacroGraph->GetName().Contains(TEXT("Loop"));
+	}
+
+	// Constant ForLoop bounds are used as is, anything else falls back to the assumed count
+	static double GetLoopIterations(const UEdGraphNode* Node, int32 AssumedLoopIterations)
+	{
+		const UEdGraphPin* FirstIndexPin = Node->FindPin(TEXT("FirstIndex"), EGPD_Input);
+		const UEdGraphPin* LastIndexPin = Node->FindPin(TEXT("LastIndex"), EGPD_Input);
+		if (FirstIndexPin && LastIndexPin && FirstIndexPin->LinkedTo.IsEmpty() && LastIndexPin->LinkedTo.IsEmpty())
+		{
+			return FMath::Max(0, FCString::Atoi(*LastIndexPin->GetDefaultAsString()) - FCString::Atoi(*FirstIndexPin->GetDefaultAsString()) + 1);
+		}
+
+		return AssumedLoopIterations;
+	}
+
+	static void MergeEstimate(const FCostEstimate& Callee, double Multiplier, FCostEstimate& InOutEstimate)
+	{
+		InOutEstimate.NodeExecutions += Callee.NodeExecutions * Multiplier;
+		for (int32 Cost = 0; Cost < static_cast<int32>(EConstructionScriptCost::Num); ++Cost)
+		{
+			InOutEstimate.Costs[Cost] += Callee.Costs[Cost] * Multiplier;
+		}
+
+		for (const TPair<UEdGraphNode*, FCostNode>& CostNode : Callee.CostNodes)
+		{
+			FCostNode* Existing = InOutEstimate.CostNodes.Find(CostNode.Key);
+			if (!Existing)
+			{
+				Existing = &InOutEstimate.CostNodes.Add(CostNode.Key, CostNode.Value);
+				Existing->Executions = 0.0;
+			}
+			Existing->Executions += CostNode.Value.Executions * Multiplier;
+		}
+	}
+
+	struct FEstimator
+	{
+		UBlueprint* Blueprint = nullptr;
+		int32 AssumedLoopIterations = 1;
+
+		// One run of each function or collapsed graph, estimated once however many call sites it has
+		TMap<UEdGraph*, FCostEstimate> GraphEstimates;
+		TSet<UEdGraph*> GraphsInProgress;
+
+		const FCostEstimate& EstimateCalledGraph(UEdGraph* Graph)
+		{
+			if (const FCostEstimate* Existing = GraphEstimates.Find(Graph))
+			{
+				return *Existing;
+			}
+
+			// Recursion costs nothing extra, we can't know how deep it goes
+			static const FCostEstimate Empty;
+			bool bAlreadyInProgress = false;
+			GraphsInProgress.Add(Graph, &bAlreadyInProgress);
+			if (bAlreadyInProgress)
+			{
+				return Empty;
+			}
+
+			FCostEstimate Estimate;
+			EstimateGraph(Graph, Estimate);
+			GraphsInProgress.Remove(Graph);
+
+			return GraphEstimates.Add(Graph, MoveTemp(Estimate));
+		}
+
+		void EstimateGraph(UEdGraph* Graph, FCostEstimate& OutEstimate)
+		{
+			struct FPendingNode
+			{
+				UEdGraphNode* Node;
+				double Multiplier;
+				int32 LoopNesting;
+			};
+
+			// Function entries, or the input tunnel of a collapsed graph
+			TArray<FPendingNode> Pending;
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				const UK2Node_Tunnel* TunnelNode = Cast<UK2Node_Tunnel>(Node);
+				const bool bIsInputTunnel = TunnelNode && TunnelNode->GetClass() == UK2Node_Tunnel::StaticClass() && TunnelNode->bCanHaveOutputs;
+				if (Node && (Node->IsA<UK2Node_FunctionEntry>() || bIsInputTunnel))
+				{
+					Pending.Add({ Node, 1.0, 0 });
+				}
+			}
+
+			// Highest multiplier each node is reached with along the exec flow
+			TMap<UEdGraphNode*, double> NodeMultipliers;
+			while (!Pending.IsEmpty())
+			{
+				const FPendingNode Current = Pending.Pop();
+
+				const double* ExistingMultiplier = NodeMultipliers.Find(Current.Node);
+				if (ExistingMultiplier && *ExistingMultiplier >= Current.Multiplier)
+				{
+					continue;
+				}
+				NodeMultipliers.Add(Current.Node, Current.Multiplier);
+
+				const bool bIsLoop = IsLoopMacro(Current.Node) && Current.LoopNesting < MaximumLoopNesting;
+				const double BodyMultiplier = bIsLoop ? Current.Multiplier * GetLoopIterations(Current.Node, AssumedLoopIterations) : Current.Multiplier;
+
+				for (const UEdGraphPin* Pin : Current.Node->Pins)
+				{
+					if (!Pin || Pin->Direction != EGPD_Output || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+					{
+						continue;
+					}
+
+					const bool bIsLoopBody = bIsLoop && Pin->PinName == TEXT("LoopBody");
+					for (const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+					{
+						if (LinkedPin && LinkedPin->GetOwningNode())
+						{
+							Pending.Add({ LinkedPin->GetOwningNode(), bIsLoopBody ? BodyMultiplier : Current.Multiplier, Current.LoopNesting + (bIsLoopBody ? 1 : 0) });
+						}
+					}
+				}
+			}
+
+			for (const TPair<UEdGraphNode*, double>& NodeMultiplier : NodeMultipliers)
+			{
+				UEdGraphNode* Node = NodeMultiplier.Key;
+				const double Multiplier = NodeMultiplier.Value;
+
+				OutEstimate.NodeExecutions += Multiplier;
+
+				const EConstructionScriptCost Cost = UEditorValidator_ConstructionScript::GetNodeCost(Node);
+				if (Cost != EConstructionScriptCost::Num)
+				{
+					OutEstimate.Costs[static_cast<int32>(Cost)] += Multiplier;
+
+					FCostNode& CostNode = OutEstimate.CostNodes.FindOrAdd(Node);
+					CostNode.Graph = Graph;
+					CostNode.Node = Node;
+					CostNode.Cost = Cost;
+					CostNode.Executions += Multiplier;
+					continue;
+				}
+
+				if (const UK2Node_Composite* CompositeNode = Cast<UK2Node_Composite>(Node))
+				{
+					if (CompositeNode->BoundGraph)
+					{
+						MergeEstimate(EstimateCalledGraph(CompositeNode->BoundGraph), Multiplier, OutEstimate);
+					}
+				}
+				else if (const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+				{
+					// Functions of this blueprint run as part of the construction too
+					if (!CallNode->FunctionReference.IsSelfContext())
+					{
+						continue;
+					}
+
+					const FName FunctionName = CallNode->GetFunctionName();
+					UEdGraph* const* CalledGraph = Blueprint->FunctionGraphs.FindByPredicate([FunctionName](const UEdGraph* FunctionGraph) { return FunctionGraph && FunctionGraph->GetFName() == FunctionName; });
+					if (CalledGraph)
+					{
+						MergeEstimate(EstimateCalledGraph(*CalledGraph), Multiplier, OutEstimate);
+					}
+				}
+			}
+		}
+	};
+
+	static FText GetCostName(EConstructionScriptCost Cost)
+	{
+		switch (Cost)
+		{
+		case EConstructionScriptCost::Spawn:
+			return LOCTEXT("CommonValidators.ConstructionScript.Spawn", "actor spawns and added components");
+		case EConstructionScriptCost::Trace:
+			return LOCTEXT("CommonValidators.ConstructionScript.Trace", "traces and overlap queries");
+		case EConstructionScriptCost::BlockingLoad:
+			return LOCTEXT("CommonValidators.ConstructionScript.BlockingLoad", "blocking loads");
+		case EConstructionScriptCost::DynamicMaterial:
+			return LOCTEXT("CommonValidators.ConstructionScript.DynamicMaterial", "dynamic material instances");
+		default:
+			return FText::GetEmpty();
+		}
+	}
+
+	static int32 GetCostBudget(const UCommonValidatorsDeveloperSettings* DevSettings, EConstructionScriptCost Cost)
+	{
+		switch (Cost)
+		{
+		case EConstructionScriptCost::Spawn:
+			return DevSettings->MaximumConstructionScriptSpawns;
+		case EConstructionScriptCost::Trace:
+			return DevSettings->MaximumConstructionScriptTraces;
+		case EConstructionScriptCost::DynamicMaterial:
+			return DevSettings->MaximumConstructionScriptDynamicMaterials;
+		default:
+			// Never acceptable in a construction script
+			return 0;
+		}
+	}
+
+	static FText AsExecutions(double Executions)
+	{
+		return FText::AsNumber(FMath::CeilToInt64(Executions));
+	}
+} // namespace UE::Internal::ConstructionScriptValidatorHelpers
+
+
+bool UEditorValidator_ConstructionScript::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableConstructionScriptValidator;
+	return bIsValidatorEnabled && InObject && InObject->IsA<UBlueprint>();
+}
+
+EDataValidationResult UEditorValidator_ConstructionScript::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	using namespace UE::Internal::ConstructionScriptValidatorHelpers;
+
+	UBlueprint* Blueprint = Cast<UBlueprint>(InAsset);
+	if (!Blueprint) return EDataValidationResult::NotValidated;
+
+	// Only actor blueprints have one
+	UEdGraph* ConstructionScript = FBlueprintEditorUtils::FindUserConstructionScript(Blueprint);
+	if (!ConstructionScript)
+	{
+		return EDataValidationResult::Valid;
+	}
+
+	const UCommonValidatorsDeveloperSettings* DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnConstructionScript ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundIssue = false;
+
+	FCostEstimate Estimate;
+	EstimateGraphCost(Blueprint, ConstructionScript, DevSettings->ConstructionScriptAssumedLoopIterations, Estimate);
+
+	auto AddMessage = [&](const FText& Text, UEdGraph* Graph, UEdGraphNode* Node)
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedNodeMessage(InAssetData, Text, Severity, Blueprint, Graph, Node));
+		bFoundIssue = true;
+	};
+
+	if (Estimate.NodeExecutions > DevSettings->MaximumConstructionScriptNodes)
+	{
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.ConstructionScript.Nodes", "Construction script runs an estimated {0} nodes per construction, the budget is {1}. It runs on every spawn and on every property change in the editor."),
+			AsExecutions(Estimate.NodeExecutions),
+			DevSettings->MaximumConstructionScriptNodes), nullptr, nullptr);
+	}
+
+	for (int32 CostIndex = 0; CostIndex < static_cast<int32>(EConstructionScriptCost::Num); ++CostIndex)
+	{
+		const EConstructionScriptCost Cost = static_cast<EConstructionScriptCost>(CostIndex);
+		const int32 Budget = GetCostBudget(DevSettings, Cost);
+		if (Estimate.Costs[CostIndex] <= Budget)
+		{
+			continue;
+		}
+
+		TArray<const FCostNode*> CostNodes;
+		for (const TPair<UEdGraphNode*, FCostNode>& CostNode : Estimate.CostNodes)
+		{
+			if (CostNode.Value.Cost == Cost)
+			{
+				CostNodes.Add(&CostNode.Value);
+			}
+		}
+		CostNodes.Sort([](const FCostNode& A, const FCostNode& B) { return A.Executions > B.Executions; });
+
+		TArray<FString> NodeDescriptions;
+		for (const FCostNode* CostNode : CostNodes)
+		{
+			NodeDescriptions.Add(FString::Printf(TEXT("%s (%s x%s)"), *CostNode->Node->GetNodeTitle(ENodeTitleType::ListView).ToString(),
+				*CostNode->Graph->GetName(), *AsExecutions(CostNode->Executions).ToString()));
+		}
+
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.ConstructionScript.Cost", "Construction script runs an estimated {0} {1} per construction, the budget is {2}: {3}"),
+			AsExecutions(Estimate.Costs[CostIndex]),
+			GetCostName(Cost),
+			Budget,
+			FText::FromString(FString::Join(NodeDescriptions, TEXT(", ")))),
+			CostNodes.IsEmpty() ? nullptr : CostNodes[0]->Graph,
+			CostNodes.IsEmpty() ? nullptr : CostNodes[0]->Node);
+	}
+
+	return (bFoundIssue && DevSettings->bErrorOnConstructionScript) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+void UEditorValidator_ConstructionScript::EstimateGraphCost(UBlueprint* Blueprint, UEdGraph* Graph, int32 AssumedLoopIterations, FCostEstimate& OutEstimate)
+{
+	UE::Internal::ConstructionScriptValidatorHelpers::FEstimator Estimator;
+	Estimator.Blueprint = Blueprint;
+	Estimator.AssumedLoopIterations = FMath::Max(1, AssumedLoopIterations);
+
+	// Guards calls back into the construction script itself
+	Estimator.GraphsInProgress.Add(Graph);
+	Estimator.EstimateGraph(Graph, OutEstimate);
+}
+
+EConstructionScriptCost UEditorValidator_ConstructionScript::GetNodeCost(const UEdGraphNode* Node)
+{
+	// AddComponent is a function call node, check the spawning node classes first
+	if (Node->IsA<UK2Node_SpawnActorFromClass>() || Node->IsA<UK2Node_AddComponent>() || Node->IsA<UK2Node_AddComponentByClass>())
+	{
+		return EConstructionScriptCost::Spawn;
+	}
+
+	const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+	if (!CallNode)
+	{
+		return EConstructionScriptCost::Num;
+	}
+
+	const FName FunctionName = CallNode->GetFunctionName();
+	if (FBlueprintGraphAnalysis::IsBlockingLoadFunction(FunctionName))
+	{
+		return EConstructionScriptCost::BlockingLoad;
+	}
+
+	static const TSet<FName> SpawnFunctionNames = { TEXT("BeginDeferredActorSpawnFromClass"), TEXT("AddComponentByClass") };
+	if (SpawnFunctionNames.Contains(FunctionName))
+	{
+		return EConstructionScriptCost::Spawn;
+	}
+
+	static const TSet<FName> DynamicMaterialFunctionNames = { TEXT("CreateDynamicMaterialInstance"), TEXT("CreateAndSetMaterialInstanceDynamic"), TEXT("CreateAndSetMaterialInstanceDynamicFromMaterial") };
+	if (DynamicMaterialFunctionNames.Contains(FunctionName))
+	{
+		return EConstructionScriptCost::DynamicMaterial;
+	}
+
+	// Kismet system library traces and overlaps, by channel, profile and object types
+	static const TCHAR* TracePrefixes[] = { TEXT("LineTrace"), TEXT("SphereTrace"), TEXT("BoxTrace"), TEXT("CapsuleTrace"),
+		TEXT("SphereOverlap"), TEXT("BoxOverlap"), TEXT("CapsuleOverlap"), TEXT("ComponentOverlap") };
+	const FString FunctionNameString = FunctionName.ToString();
+	for (const TCHAR* TracePrefix : TracePrefixes)
+	{
+		if (FunctionNameString.StartsWith(TracePrefix))
+		{
+			return EConstructionScriptCost::Trace;
+		}
+	}
+
+	return EConstructionScriptCost::Num;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_ConstructionScript.generated.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+
+enum class EConstructionScriptCost : uint8
+{
+	Spawn,
+	Trace,
+	BlockingLoad,
+	DynamicMaterial,
+
+	Num
+};
+
+/**
+ * Estimates the work done by an actor's UserConstructionScript, which runs on every spawn and on every property change
+ * in the editor. Follows the exec flow from the entry node, multiplies loop bodies by their iteration count and
+ * includes the blueprint's own functions it calls. Spawns, traces and dynamic material instances are checked against
+ * per construction budgets, blocking loads are always reported.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_ConstructionScript : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+public:
+	struct FCostNode
+	{
+		UEdGraph* Graph = nullptr;
+		UEdGraphNode* Node = nullptr;
+		EConstructionScriptCost Cost = EConstructionScriptCost::Num;
+		// Estimated executions per construction
+		double Executions = 0.0;
+	};
+
+	struct FCostEstimate
+	{
+		double NodeExecutions = 0.0;
+		double Costs[static_cast<int32>(EConstructionScriptCost::Num)] = {};
+		// Nodes contributing to Costs, keyed by node so call sites of the same function add up
+		TMap<UEdGraphNode*, FCostNode> CostNodes;
+	};
+
+	// Estimated work of one run of Graph, usually the UserConstructionScript, AssumedLoopIterations is used for loops without a constant count
+	static void EstimateGraphCost(UBlueprint* Blueprint, UEdGraph* Graph, int32 AssumedLoopIterations, FCostEstimate& OutEstimate);
+
+	// Cost category of a node, Num when it isn't one of the tracked ones
+	static EConstructionScriptCost GetNodeCost(const UEdGraphNode* Node);
+};
@@ -11,72 +11,77 @@
 #include "CommonValidatorsStatics.h"
 #include "Engine/MemberReference.h"
 #include "CommonValidatorsDeveloperSettings.h"
+#include "BlueprintGraphSnapshot.h"
 
 bool UEditorValidator_EmptyTick::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
 {
-#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6)
-	// Empty ticks are automatically disabled in UE 5.6 onwards, no need to do anything for those versions
-	return false;
-#else
-	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableEmptyTickNodeValidator;
-	return bIsValidatorEnabled && InObject && InObject->IsA<UBlueprint>();
-#endif
+	return IsEmptyTickValidationNeeded() && InObject && InObject->IsA<UBlueprint>();
 }
 
 EDataValidationResult UEditorValidator_EmptyTick::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-	static const FName EventTickName(TEXT("ReceiveTick"));
-
 	UBlueprint* Blueprint = Cast<UBlueprint>(InAsset);
 	if (!Blueprint) return EDataValidationResult::NotValidated;
 
-	for (UEdGraph* Graph : Blueprint->UbergraphPages)
-	{
-		for (UEdGraphNode* Node : Graph->Nodes)
-		{
-			UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
-			if (EventNode && EventNode->EventReference.GetMemberName() == EventTickName)
-			{
-				if (IsEmptyTick(EventNode))
-				{
-					bool bShouldError = GetDefault<UCommonValidatorsDeveloperSettings>()->bErrorOnEmptyTickNodes;
-					// add message, with two actions: one to open the blueprint and focus the node, and one to remove the empty tick node
-					TSharedRef<FTokenizedMessage> TokenizedMessage = FTokenizedMessage::Create((bShouldError ? EMessageSeverity::Error : EMessageSeverity::Warning), FText::FromString(TEXT("Empty Tick nodes still produce overhead, please use or remove it. ")));
-					TokenizedMessage->AddToken(FActionToken::Create(
-						FText::FromString(TEXT("Open Blueprint and Focus Node")),
-						FText::FromString(TEXT("Open Blueprint and Focus Node")),
-						FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, EventNode]()
-							{
-								UCommonValidatorsStatics::OpenBlueprintAndFocusNode(Blueprint, Graph, EventNode);
-							}),
-						false
-					));
+	// Shared with the other graph validators of the validation pass
+	const TSharedRef<const FBlueprintGraphAnalysisCache::FEntry> Analysis = FBlueprintGraphAnalysisCache::Get().FindOrAnalyze(Blueprint);
+	const FBlueprintGraphSnapshot& Snapshot = Analysis->Snapshot;
+	const FBlueprintGraphSnapshotSource& Source = Analysis->Source;
 
-					TokenizedMessage->AddToken(FActionToken::Create(
-						FText::FromString(TEXT("Remove Empty Tick Node")),
-						FText::FromString(TEXT("Remove Empty Tick Node")),
-						FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, EventNode]()
-							{
-								UCommonValidatorsStatics::DeleteNodeFromBlueprint(Blueprint, Graph, EventNode);
-							}),
-						false
-					));
+	const TArray<int32>& EmptyTicks = Analysis->Result.EmptyTicks;
+	if (EmptyTicks.IsEmpty())
+	{
+		return EDataValidationResult::Valid;
+	}
 
-					Context.AddMessage(TokenizedMessage);
-					
-					return bShouldError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
-				}
-			}
-		}
+	// There can only be one tick event per blueprint
+	UEdGraph* Graph = Source.Graphs[Snapshot.Nodes[EmptyTicks[0]].Graph].Get();
+	UK2Node_Event* EventNode = Cast<UK2Node_Event>(Source.Nodes[EmptyTicks[0]].Get());
+	if (!Graph || !EventNode)
+	{
+		return EDataValidationResult::Valid;
 	}
 
-	return EDataValidationResult::Valid;
+	Context.AddMessage(CreateEmptyTickMessage(Blueprint, Graph, EventNode));
+
+	bool bShouldError = GetDefault<UCommonValidatorsDeveloperSettings>()->bErrorOnEmptyTickNodes;
+	return bShouldError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
 
-bool UEditorValidator_EmptyTick::IsEmptyTick(UK2Node_Event* EventNode)
+bool UEditorValidator_EmptyTick::IsEmptyTickValidationNeeded()
 {
-	if (EventNode->IsAutomaticallyPlacedGhostNode()) return false; // Ghost nodes aren't real nodes
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6)
+	// Empty ticks are automatically disabled in UE 5.6 onwards, no need to do anything for those versions
+	return false;
+#else
+	return GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableEmptyTickNodeValidator;
+#endif
+}
+
+TSharedRef<FTokenizedMessage> UEditorValidator_EmptyTick::CreateEmptyTickMessage(UBlueprint* Blueprint, UEdGraph* Graph, UK2Node_Event* EventNode)
+{
+	bool bShouldError = GetDefault<UCommonValidatorsDeveloperSettings>()->bErrorOnEmptyTickNodes;
+	// add message, with two actions: one to open the blueprint and focus the node, and one to remove the empty tick node
+	TSharedRef<FTokenizedMessage> TokenizedMessage = FTokenizedMessage::Create((bShouldError ? EMessageSeverity::Error : EMessageSeverity::Warning), FText::FromString(TEXT("Empty Tick nodes still produce overhead, please use or remove it. ")));
+	TokenizedMessage->AddToken(FActionToken::Create(
+		FText::FromString(TEXT("Open Blueprint and Focus Node")),
+		FText::FromString(TEXT("Open Blueprint and Focus Node")),
+		FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, EventNode]()
+			{
+				UCommonValidatorsStatics::OpenBlueprintAndFocusNode(Blueprint, Graph, EventNode);
+			}),
+		false
+	));
+
+	TokenizedMessage->AddToken(FActionToken::Create(
+		FText::FromString(TEXT("Remove Empty Tick Node")),
+		FText::FromString(TEXT("Remove Empty Tick Node")),
+		FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, EventNode]()
+			{
+				UCommonValidatorsStatics::DeleteNodeFromBlueprint(Blueprint, Graph, EventNode);
+			}),
+		false
+	));
 
-	UEdGraphPin* ExecThenPin = EventNode->FindPin(UEdGraphSchema_K2::PN_Then);
-	return ExecThenPin && ExecThenPin->LinkedTo.IsEmpty();
+	return TokenizedMessage;
 }
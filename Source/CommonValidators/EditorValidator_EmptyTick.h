@@ -4,6 +4,10 @@
 #include "EditorValidatorBase.h"
 #include "EditorValidator_EmptyTick.generated.h"
 
+class UBlueprint;
+class UEdGraph;
+class FTokenizedMessage;
+
 UCLASS()
 class COMMONVALIDATORS_API UEditorValidator_EmptyTick : public UEditorValidatorBase
 {
@@ -12,5 +16,9 @@ class COMMONVALIDATORS_API UEditorValidator_EmptyTick : public UEditorValidatorB
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 
-	bool IsEmptyTick(class UK2Node_Event* EventNode);
+public:
+	// False when disabled in settings or when the engine already skips empty ticks
+	static bool IsEmptyTickValidationNeeded();
+
+	static TSharedRef<FTokenizedMessage> CreateEmptyTickMessage(UBlueprint* Blueprint, UEdGraph* Graph, class UK2Node_Event* EventNode);
 };
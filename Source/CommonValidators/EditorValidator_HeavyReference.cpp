@@ -9,13 +9,23 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/AssetManager.h"
 #include "Engine/Blueprint.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/LevelStreamingAlwaysLoaded.h"
+#include "Engine/World.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Misc/DataValidation.h"
+#include "WorldPartition/WorldPartitionActorDesc.h"
+#include "WorldPartition/WorldPartitionActorDescUtils.h"
 
 // Project
 
 // Local
+#include "CommonValidatorsDependencySnapshot.h"
+#include "CommonValidatorsSizeProvider.h"
 #include "CommonValidatorsStatics.h"
+#include "HeavyReferenceClosureCache.h"
+#include "HeavyReferenceResidentBaseline.h"
 
 // Gen CPP
 #include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_HeavyReference)
@@ -38,14 +48,8 @@ bool UEditorValidator_HeavyReference::CanValidateAsset_Implementation(
 		return false;
 	}
 
-	UBlueprint* Blueprint = Cast<UBlueprint>(InObject);
-	if (!IsValid(Blueprint))
-	{
-		return false;
-	}
-
 	// Check if we want to run validation here
-	// Remove any BPs that inherit from the classes in class and child list
+	// Remove any assets that inherit from the classes in class and child list
 	{
 		const TArray<TSubclassOf<UObject>>& IgnoreChildrenList = GetDefault<UCommonValidatorsDeveloperSettings>()->
 			HeavyValidatorClassAndChildIgnoreList;
@@ -58,8 +62,7 @@ bool UEditorValidator_HeavyReference::CanValidateAsset_Implementation(
 		}
 	}
 
-	// Limit to BPs for now?
-	return true && InObject->IsA<UBlueprint>();
+	return true;
 }
 
 
@@ -69,16 +72,9 @@ EDataValidationResult UEditorValidator_HeavyReference::ValidateLoadedAsset_Imple
 	const UCommonValidatorsDeveloperSettings* const DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
 	const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	const IAssetRegistry* const AssetRegistry = &AssetRegistryModule.Get();
-	IAssetManagerEditorModule* const EditorModule = &IAssetManagerEditorModule::Get();
-
-	// Ignore non-BP types
-	UBlueprint* Blueprint = Cast<UBlueprint>(InAsset);
-	if (!IsValid(Blueprint))
-	{
-		return EDataValidationResult::NotValidated;
-	}
+	ICommonValidatorsSizeProvider& SizeProvider = ICommonValidatorsSizeProvider::Get();
 
-	// Remove any BPs that inherit from the classes in class and child list
+	// Remove any assets that inherit from the classes in class and child list
 	{
 		const TArray<TSubclassOf<UObject>>& IgnoreChildrenList = DevSettings->HeavyValidatorClassAndChildIgnoreList;
 		for (const TSubclassOf<UObject>& IgnoredChild : IgnoreChildrenList)
@@ -93,6 +89,23 @@ EDataValidationResult UEditorValidator_HeavyReference::ValidateLoadedAsset_Imple
 	// Convert to AssetIdentifier as that's what we are using in the loop
 	FAssetIdentifier InAssetIdentifier = UCommonValidatorsStatics::GetAssetIdentifierFromAssetData(InAssetData);
 
+	// Specific Ref Classes to ignore for the root asset
+	TArray<TSubclassOf<UObject>, TInlineAllocator<8>> IgnoredClassList;
+	GatherIgnoredClasses(DevSettings, InAsset, IgnoredClassList);
+
+	// Content the game keeps resident anyway isn't charged to the asset, built once and dropped on any registry change
+	FHeavyReferenceResidentBaseline& ResidentBaseline = FHeavyReferenceResidentBaseline::Get();
+	const bool bSubtractBaseline = DevSettings->bSubtractResidentBaseline && (ResidentBaseline.IsBuilt() || ResidentBaseline.Build(AssetRegistryModule.Get()));
+
+	// Maps load in pieces, a single closure over the map package would miss external actors and streaming levels
+	if (UWorld* World = Cast<UWorld>(InAsset))
+	{
+		EDataValidationResult WorldResult = EDataValidationResult::Valid;
+		if (ValidateWorld(InAssetData, World, IgnoredClassList, Context, WorldResult))
+		{
+			return WorldResult;
+		}
+	}
 
 	// Got assets. We want to sizemap these
 	TSet<FAssetIdentifier> VisitList;
@@ -100,6 +113,74 @@ EDataValidationResult UEditorValidator_HeavyReference::ValidateLoadedAsset_Imple
 	FoundAssetList.Add(InAssetIdentifier);
 	uint64 TotalSize = 0;
 
+	// Batch runs can size every package's closure in one pass up front.
+	// The precomputed closures know nothing about per-root ignore lists or unsizable children, so only use them when neither applies.
+	FHeavyReferenceClosureCache& ClosureCache = FHeavyReferenceClosureCache::Get();
+	if (!ClosureCache.IsBuilt() && DevSettings->bPrecomputeHeavyReferenceClosuresInCommandlets && IsRunningCommandlet())
+	{
+		ClosureCache.Build(AssetRegistryModule.Get());
+	}
+
+	// Otherwise walk the flat dependency graph snapshot when it's up to date, no registry queries or path strings needed.
+	// Only falls back to the registry walk below for non-package roots or while the snapshot is still being reconciled.
+	const FCommonValidatorsDependencySnapshot& Snapshot = FCommonValidatorsDependencySnapshot::Get();
+	const int32 SnapshotRootIndex = (InAssetIdentifier.IsPackage() && Snapshot.IsReady()) ? Snapshot.GetGraph().FindPackageIndex(InAssetIdentifier.PackageName) : INDEX_NONE;
+
+	// Precomputed closures include resident content, the baseline can only be subtracted while walking.
+	// Assets that are part of the baseline would subtract themselves, those are sized in full.
+	const bool bSubtractedBaseline = bSubtractBaseline && SnapshotRootIndex != INDEX_NONE && !ResidentBaseline.IsResident(SnapshotRootIndex);
+	// Once per session, folder validations would otherwise repeat it for every asset
+	static bool bWarnedBaselineUnavailable = false;
+	if (DevSettings->bSubtractResidentBaseline && (!bSubtractBaseline || SnapshotRootIndex == INDEX_NONE) && !bWarnedBaselineUnavailable)
+	{
+		UE_LOG(LogCommonValidators, Warning, TEXT("Resident baseline is enabled but the dependency graph snapshot isn't available for %s, sizing full closures until it is."), *InAssetIdentifier.ToString());
+		bWarnedBaselineUnavailable = true;
+	}
+
+	if (!bSubtractedBaseline && InAssetIdentifier.IsPackage() && IgnoredClassList.IsEmpty() && !DevSettings->bWarnOnUnsizableChildren
+		&& ClosureCache.TryGetClosureSize(InAssetIdentifier.PackageName, TotalSize))
+	{
+		FoundAssetList.Reset();
+	}
+	else if (SnapshotRootIndex != INDEX_NONE)
+	{
+		const FCommonValidatorsDependencyGraph& Graph = Snapshot.GetGraph();
+		TArray<int32> UnsizedPackages;
+
+		auto ShouldInclude = [&](int32 PackageIndex)
+		{
+			if (IgnoredClassList.IsEmpty())
+			{
+				return true;
+			}
+
+			FAssetData ThisAssetData{};
+			return GetAssetData(AssetRegistry, FAssetIdentifier(Graph.GetPackageName(PackageIndex)), ThisAssetData)
+				&& IsAssetIncluded(IgnoredClassList, ThisAssetData);
+		};
+
+		if (bSubtractedBaseline)
+		{
+			// Resident packages start out visited, so the walk stops at them and only sizes what loading the asset adds
+			TBitArray<> Visited;
+			ResidentBaseline.CopyResidentPackages(Visited, Graph.Num());
+			Visited[SnapshotRootIndex] = true;
+			TotalSize = Graph.ComputeReachableSize(Graph.GetDependencies(SnapshotRootIndex), ShouldInclude, Visited, DevSettings->bWarnOnUnsizableChildren ? &UnsizedPackages : nullptr);
+		}
+		else
+		{
+			TotalSize = Graph.ComputeClosureSize(SnapshotRootIndex, ShouldInclude, DevSettings->bWarnOnUnsizableChildren ? &UnsizedPackages : nullptr);
+		}
+
+		for (const int32 UnsizedPackage : UnsizedPackages)
+		{
+			const FString AssetPackageNameString = Graph.GetPackageName(UnsizedPackage).ToString();
+			AddUnsizableChildMessage(InAssetData, AssetPackageNameString, AssetPackageNameString, Context);
+		}
+
+		FoundAssetList.Reset();
+	}
+
 	for (uint64 Index = 0; Index < FoundAssetList.Num(); ++Index)
 	{
 		const FAssetIdentifier& FoundAssetId = FoundAssetList[Index];
@@ -122,7 +203,7 @@ EDataValidationResult UEditorValidator_HeavyReference::ValidateLoadedAsset_Imple
 
 		// Go for asset sizing
 		// Skip including checks on the first iteration
-		if (Index == 0 || IsAssetIncluded(DevSettings, InAsset, ThisAssetData))
+		if (Index == 0 || IsAssetIncluded(IgnoredClassList, ThisAssetData))
 		{
 			FAssetManagerDependencyQuery DependencyQuery = SetupDependencyQuery(AssetPackageName);
 
@@ -130,25 +211,15 @@ EDataValidationResult UEditorValidator_HeavyReference::ValidateLoadedAsset_Imple
 			// We are not a reference: we are us.
 			if (AssetPackageName != NAME_None && Index > 0)
 			{
-				int64 FoundSize = 0;
-				if (EditorModule->GetIntegerValueForCustomColumn(ThisAssetData, IAssetManagerEditorModule::ResourceSizeName, FoundSize))
+				const int64 FoundSize = SizeProvider.GetPackageSize(AssetPackageName);
+				if (FoundSize >= 0)
 				{
 					TotalSize += FoundSize;
 				}
 				else if (DevSettings->bWarnOnUnsizableChildren)
 				{
 					const FString AssetPackageNameString = (AssetPackageName != NAME_None) ? AssetPackageName.ToString() : FString();
-
-					TSharedRef<FTokenizedMessage> ResultMessage = UCommonValidatorsStatics::CreateLinkedMessage(InAssetData,
-							FText::Format(
-								LOCTEXT("CommonValidators.HeavyRef.AssetWarning", "Failed to get memory size for {0}! ({1})"),
-								FText::FromString(FoundAssetId.ToString()),
-								FText::FromString(AssetPackageNameString)
-								),
-							EMessageSeverity::Warning
-						);
-					
-					Context.AddMessage(ResultMessage);
+					AddUnsizableChildMessage(InAssetData, FoundAssetId.ToString(), AssetPackageNameString, Context);
 				}
 			}
 
@@ -164,13 +235,19 @@ EDataValidationResult UEditorValidator_HeavyReference::ValidateLoadedAsset_Imple
 		}
 	}
 
-	if (TotalSize > DevSettings->MaximumAllowedReferenceSizeKiloBytes * 1024)
+	if (TotalSize > static_cast<uint64>(GetBudgetBytes(DevSettings, InAsset)))
 	{
 		TSharedRef<FTokenizedMessage> ResultMessage = UCommonValidatorsStatics::CreateLinkedMessage(InAssetData,
-				FText::Format(
+				bSubtractedBaseline
+				? FText::Format(
+					LOCTEXT("CommonValidators.HeavyRef.AssetIncrementalWarning", "Heavy references in asset {0}! ({1} on top of the resident baseline)"),
+					FText::FromString(InAssetIdentifier.ToString()),
+					FText::AsMemory(TotalSize)
+					)
+				: FText::Format(
 					LOCTEXT("CommonValidators.HeavyRef.AssetWarning", "Heavy references in asset {0}! ({1})"),
 					FText::FromString(InAssetIdentifier.ToString()),
-					TotalSize
+					FText::AsMemory(TotalSize)
 					),
 				(DevSettings->bErrorHeavyReference ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning)
 			);
@@ -183,10 +260,235 @@ EDataValidationResult UEditorValidator_HeavyReference::ValidateLoadedAsset_Imple
 	return EDataValidationResult::Valid;
 }
 
-bool UEditorValidator_HeavyReference::IsAssetIncluded(const UCommonValidatorsDeveloperSettings* const DevSettings, const UObject* const InAsset, const FAssetData& ThisAssetData)
+EDataValidationResult UEditorValidator_HeavyReference::ValidateAsset(const FAssetData& InAssetData, FDataValidationContext& Context)
+{
+	UObject* Asset = InAssetData.GetAsset();
+	if (!Asset || !CanValidateAsset_Implementation(InAssetData, Asset, Context))
+	{
+		return EDataValidationResult::NotValidated;
+	}
+
+	return ValidateLoadedAsset_Implementation(InAssetData, Asset, Context);
+}
+
+int64 UEditorValidator_HeavyReference::GetBudgetBytes(const UCommonValidatorsDeveloperSettings* const DevSettings, const UObject* const InAsset) const
+{
+	int64 BudgetKiloBytes = DevSettings->MaximumAllowedReferenceSizeKiloBytes;
+	int32 BestDepth = INDEX_NONE;
+
+	for (const TPair<TSubclassOf<UObject>, int32>& ClassBudget : DevSettings->HeavyReferenceClassBudgetsKiloBytes)
+	{
+		if (!ClassBudget.Key || !UCommonValidatorsStatics::IsObjectAChildOf(InAsset, ClassBudget.Key))
+		{
+			continue;
+		}
+
+		int32 Depth = 0;
+		for (const UStruct* Struct = ClassBudget.Key; Struct; Struct = Struct->GetSuperStruct())
+		{
+			++Depth;
+		}
+
+		if (Depth > BestDepth)
+		{
+			BestDepth = Depth;
+			BudgetKiloBytes = ClassBudget.Value;
+		}
+	}
+
+	return BudgetKiloBytes * 1024;
+}
+
+bool UEditorValidator_HeavyReference::ValidateWorld(const FAssetData& InAssetData, UWorld* World, const TArray<TSubclassOf<UObject>, TInlineAllocator<8>>& IgnoredClassList, FDataValidationContext& Context, EDataValidationResult& OutResult)
+{
+	const UCommonValidatorsDeveloperSettings* const DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	ICommonValidatorsSizeProvider& SizeProvider = ICommonValidatorsSizeProvider::Get();
+
+	FCommonValidatorsDependencySnapshot& Snapshot = FCommonValidatorsDependencySnapshot::Get();
+	if (!Snapshot.EnsureReady(AssetRegistry))
+	{
+		return false;
+	}
+
+	const FCommonValidatorsDependencyGraph& Graph = Snapshot.GetGraph();
+	const FName MapPackageName = InAssetData.PackageName;
+	const int32 MapIndex = Graph.FindPackageIndex(MapPackageName);
+	if (MapIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	auto ShouldInclude = [&](int32 PackageIndex)
+	{
+		if (IgnoredClassList.IsEmpty())
+		{
+			return true;
+		}
+
+		FAssetData ThisAssetData{};
+		return GetAssetData(&AssetRegistry, FAssetIdentifier(Graph.GetPackageName(PackageIndex)), ThisAssetData)
+			&& IsAssetIncluded(IgnoredClassList, ThisAssetData);
+	};
+
+	// Something loaded as a unit: an external actor (its own package plus what it references) or a streaming level
+	struct FLoadUnit
+	{
+		FText Name;
+		uint64 OwnSize = 0;
+		TArray<int32> Seeds;
+	};
+
+	TArray<int32> AlwaysLoadedSeeds(Graph.GetDependencies(MapIndex));
+	uint64 AlwaysLoadedSize = 0;
+	TArray<FLoadUnit> StreamedUnits;
+
+	// External actor packages reference the map, not the other way around, so they have to be found by path.
+	// Outside of World Partition they are all loaded with the level.
+	const bool bIsPartitioned = World->IsPartitionedWorld();
+	TArray<FAssetData> ExternalActors;
+	AssetRegistry.GetAssetsByPath(FName(*ULevel::GetExternalActorsPath(MapPackageName.ToString())), ExternalActors, /*bRecursive=*/true);
+
+	for (const FAssetData& ActorData : ExternalActors)
+	{
+		const TUniquePtr<FWorldPartitionActorDesc> ActorDesc = FWorldPartitionActorDescUtils::GetActorDescriptorFromAssetData(ActorData);
+
+		FLoadUnit Unit;
+		Unit.Name = FText::FromName((ActorDesc && !ActorDesc->GetActorLabel().IsNone()) ? ActorDesc->GetActorLabel() : ActorData.AssetName);
+		Unit.OwnSize = FMath::Max<int64>(SizeProvider.GetPackageSize(ActorData.PackageName), 0);
+
+		TArray<FAssetIdentifier> Dependencies;
+		AssetRegistry.GetDependencies(FAssetIdentifier(ActorData.PackageName), Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+			UE::AssetRegistry::EDependencyQuery::Hard | UE::AssetRegistry::EDependencyQuery::Game);
+		for (const FAssetIdentifier& Dependency : Dependencies)
+		{
+			const int32 DependencyIndex = Graph.FindPackageIndex(Dependency.PackageName);
+			if (DependencyIndex != INDEX_NONE && DependencyIndex != MapIndex)
+			{
+				Unit.Seeds.Add(DependencyIndex);
+			}
+		}
+
+		if (bIsPartitioned && ActorDesc && ActorDesc->GetIsSpatiallyLoaded())
+		{
+			StreamedUnits.Add(MoveTemp(Unit));
+		}
+		else
+		{
+			AlwaysLoadedSize += Unit.OwnSize;
+			AlwaysLoadedSeeds.Append(Unit.Seeds);
+		}
+	}
+
+	// Classic level streaming, sublevels are soft references of the persistent level
+	for (const ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+	{
+		const int32 LevelIndex = StreamingLevel ? Graph.FindPackageIndex(StreamingLevel->GetWorldAssetPackageFName()) : INDEX_NONE;
+		if (LevelIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		if (StreamingLevel->IsA<ULevelStreamingAlwaysLoaded>())
+		{
+			AlwaysLoadedSeeds.Add(LevelIndex);
+		}
+		else
+		{
+			FLoadUnit& Unit = StreamedUnits.AddDefaulted_GetRef();
+			Unit.Name = FText::FromName(StreamingLevel->GetWorldAssetPackageFName());
+			Unit.Seeds.Add(LevelIndex);
+		}
+	}
+
+	// Maps that are part of the resident baseline would subtract themselves, size those in full
+	TBitArray<> AlwaysLoaded(false, Graph.Num());
+	const FHeavyReferenceResidentBaseline& ResidentBaseline = FHeavyReferenceResidentBaseline::Get();
+	if (DevSettings->bSubtractResidentBaseline && ResidentBaseline.IsBuilt() && !ResidentBaseline.IsResident(MapIndex))
+	{
+		ResidentBaseline.CopyResidentPackages(AlwaysLoaded, Graph.Num());
+	}
+
+	// The map package itself is us, not a reference
+	AlwaysLoaded[MapIndex] = true;
+
+	TArray<int32> UnsizedPackages;
+	AlwaysLoadedSize += Graph.ComputeReachableSize(AlwaysLoadedSeeds, ShouldInclude, AlwaysLoaded, DevSettings->bWarnOnUnsizableChildren ? &UnsizedPackages : nullptr);
+
+	for (const int32 UnsizedPackage : UnsizedPackages)
+	{
+		const FString AssetPackageNameString = Graph.GetPackageName(UnsizedPackage).ToString();
+		AddUnsizableChildMessage(InAssetData, AssetPackageNameString, AssetPackageNameString, Context);
+	}
+
+	const EMessageSeverity::Type Severity = DevSettings->bErrorHeavyReference ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundHeavyReference = false;
+
+	const int64 BudgetBytes = GetBudgetBytes(DevSettings, World);
+	if (AlwaysLoadedSize > static_cast<uint64>(BudgetBytes))
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(InAssetData,
+			FText::Format(
+				LOCTEXT("CommonValidators.HeavyRef.AlwaysLoaded", "Heavy references in the always loaded content of map {0}! ({1}, the budget is {2})"),
+				FText::FromName(MapPackageName),
+				FText::AsMemory(AlwaysLoadedSize),
+				FText::AsMemory(BudgetBytes)),
+			Severity));
+		bFoundHeavyReference = true;
+	}
+
+	// Each streamed unit only adds what isn't loaded already
+	const int64 StreamedBudgetBytes = static_cast<int64>(DevSettings->MaximumAllowedStreamedReferenceSizeKiloBytes) * 1024;
+	if (StreamedBudgetBytes > 0)
+	{
+		// Units are sized against the always loaded bits, then only the bits they set are cleared again.
+		// Copying a bitset over every package per unit would be O(units * packages) on large World Partition maps.
+		TArray<int32> UnitVisited;
+		for (const FLoadUnit& Unit : StreamedUnits)
+		{
+			UnitVisited.Reset();
+			const uint64 UnitSize = Unit.OwnSize + Graph.ComputeReachableSize(Unit.Seeds, ShouldInclude, AlwaysLoaded, nullptr, &UnitVisited);
+			for (const int32 PackageIndex : UnitVisited)
+			{
+				AlwaysLoaded[PackageIndex] = false;
+			}
+
+			if (UnitSize > static_cast<uint64>(StreamedBudgetBytes))
+			{
+				Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(InAssetData,
+					FText::Format(
+						LOCTEXT("CommonValidators.HeavyRef.Streamed", "Heavy references in {0}, streamed in map {1}! It adds {2} on top of the always loaded content, the budget is {3}."),
+						Unit.Name,
+						FText::FromName(MapPackageName),
+						FText::AsMemory(UnitSize),
+						FText::AsMemory(StreamedBudgetBytes)),
+					Severity));
+				bFoundHeavyReference = true;
+			}
+		}
+	}
+
+	OutResult = (bFoundHeavyReference && DevSettings->bErrorHeavyReference) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+	return true;
+}
+
+void UEditorValidator_HeavyReference::AddUnsizableChildMessage(const FAssetData& InAssetData, const FString& ChildId, const FString& ChildPackageName, FDataValidationContext& Context)
+{
+	TSharedRef<FTokenizedMessage> ResultMessage = UCommonValidatorsStatics::CreateLinkedMessage(InAssetData,
+			FText::Format(
+				LOCTEXT("CommonValidators.HeavyRef.AssetWarning", "Failed to get memory size for {0}! ({1})"),
+				FText::FromString(ChildId),
+				FText::FromString(ChildPackageName)
+				),
+			EMessageSeverity::Warning
+		);
+
+	Context.AddMessage(ResultMessage);
+}
+
+void UEditorValidator_HeavyReference::GatherIgnoredClasses(const UCommonValidatorsDeveloperSettings* const DevSettings, const UObject* const InAsset, TArray<TSubclassOf<UObject>, TInlineAllocator<8>>& OutIgnoredClassList)
 {
 	// Gather Specific Ref Classes to ignore for the root asset
-	TArray<TSubclassOf<UObject>, TInlineAllocator<8>> IgnoredClassList;
 	for (auto& ClassToIgnoreEntry : DevSettings->HeavyValidatorClassSpecificClassIgnoreList)
 	{
 		// Does this apply to this asset?
@@ -197,11 +499,14 @@ bool UEditorValidator_HeavyReference::IsAssetIncluded(const UCommonValidatorsDev
 
 			if (UCommonValidatorsStatics::IsObjectAChildOf(InAsset, IgnoredClass))
 			{
-				IgnoredClassList.Append(ClassToIgnoreEntry.Value.ClassList);
+				OutIgnoredClassList.Append(ClassToIgnoreEntry.Value.ClassList);
 			}
 		}
 	}
+}
 
+bool UEditorValidator_HeavyReference::IsAssetIncluded(const TArray<TSubclassOf<UObject>, TInlineAllocator<8>>& IgnoredClassList, const FAssetData& ThisAssetData)
+{
 	// Ignore if this asset is in the ignore list
 	for (const TSubclassOf<UObject>& IgnoreClass : IgnoredClassList)
 	{
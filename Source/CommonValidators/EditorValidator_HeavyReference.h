@@ -8,6 +8,10 @@
 #include "EditorValidator_HeavyReference.generated.h"
 
 
+/**
+ * Flags assets whose hard reference closure is above budget. Any asset class can be validated, with per-class budgets.
+ * Maps are split into always loaded content and what each streamed actor or streaming level adds on top of it.
+ */
 UCLASS()
 class COMMONVALIDATORS_API UEditorValidator_HeavyReference : public UEditorValidatorBase
 {
@@ -16,8 +20,21 @@ class COMMONVALIDATORS_API UEditorValidator_HeavyReference : public UEditorValid
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 
+public:
+	// Loads and validates one asset outside of the validator subsystem, e.g. the referencers of a change set
+	EDataValidationResult ValidateAsset(const FAssetData& InAssetData, FDataValidationContext& Context);
+
 private:
-	bool IsAssetIncluded(const UCommonValidatorsDeveloperSettings* const DevSettings, const UObject* const InAsset, const FAssetData& ThisAssetData);
+	// MaximumAllowedReferenceSizeKiloBytes, or the budget of the most derived class in HeavyReferenceClassBudgetsKiloBytes the asset is a child of
+	int64 GetBudgetBytes(const UCommonValidatorsDeveloperSettings* const DevSettings, const UObject* const InAsset) const;
+
+	// Sizes always loaded content and each streamed actor or streaming level separately.
+	// Returns false when the dependency graph snapshot isn't available, the caller then sizes the map like any other asset.
+	bool ValidateWorld(const FAssetData& InAssetData, class UWorld* World, const TArray<TSubclassOf<UObject>, TInlineAllocator<8>>& IgnoredClassList, FDataValidationContext& Context, EDataValidationResult& OutResult);
+
+	void GatherIgnoredClasses(const UCommonValidatorsDeveloperSettings* const DevSettings, const UObject* const InAsset, TArray<TSubclassOf<UObject>, TInlineAllocator<8>>& OutIgnoredClassList);
+	bool IsAssetIncluded(const TArray<TSubclassOf<UObject>, TInlineAllocator<8>>& IgnoredClassList, const FAssetData& ThisAssetData);
+	void AddUnsizableChildMessage(const FAssetData& InAssetData, const FString& ChildId, const FString& ChildPackageName, FDataValidationContext& Context);
 	bool GetAssetData(const IAssetRegistry* const AssetRegistry, const FAssetIdentifier& FoundAssetId, FAssetData& OutAssetData);
 	FAssetManagerDependencyQuery SetupDependencyQuery(const FName& AssetName);
 	
@@ -0,0 +1,201 @@
+// This Header
+#include "EditorValidator_MaterialPermutation.h"
+
+// Unreal
+#include "Materials/Material.h"
+#include "Materials/MaterialInstance.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_MaterialPermutation)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+namespace UE::Internal::MaterialPermutationValidatorHelpers
+{
+	// A component mask is four independent channels
+	static constexpr double ComponentMaskCombinations = 16.0;
+
+	static FString JoinNames(const TArray<FName>& Names)
+	{
+		TArray<FString> Strings;
+		for (const FName& Name : Names)
+		{
+			Strings.Add(Name.ToString());
+		}
+		return FString::Join(Strings, TEXT(", "));
+	}
+
+	// Base properties such as blend mode or two sided the instance overrides, they change the shaders like static parameters do
+	static void GetBasePropertyOverrideNames(const UMaterialInstance* MaterialInstance, TArray<FName>& OutNames)
+	{
+		static const FString OverridePrefix(TEXT("bOverride_"));
+
+		for (TFieldIterator<FBoolProperty> It(FMaterialInstanceBasePropertyOverrides::StaticStruct()); It; ++It)
+		{
+			const FString PropertyName = It->GetName();
+			if (PropertyName.StartsWith(OverridePrefix) && It->GetPropertyValue_InContainer(&MaterialInstance->BasePropertyOverrides))
+			{
+				OutNames.Add(FName(PropertyName.RightChop(OverridePrefix.Len())));
+			}
+		}
+	}
+} // namespace UE::Internal::MaterialPermutationValidatorHelpers
+
+
+bool UEditorValidator_MaterialPermutation::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableMaterialPermutationValidator;
+	return bIsValidatorEnabled && InObject && (InObject->IsA<UMaterial>() || InObject->IsA<UMaterialInstance>());
+}
+
+EDataValidationResult UEditorValidator_MaterialPermutation::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	using namespace UE::Internal::MaterialPermutationValidatorHelpers;
+
+	UMaterialInterface* MaterialInterface = Cast<UMaterialInterface>(InAsset);
+	const UMaterial* BaseMaterial = MaterialInterface ? MaterialInterface->GetMaterial() : nullptr;
+	if (!BaseMaterial) return EDataValidationResult::NotValidated;
+
+	const UCommonValidatorsDeveloperSettings* DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnMaterialPermutations ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundIssue = false;
+
+	auto AddMessage = [&](const FText& Text)
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(InAssetData, Text, Severity));
+		bFoundIssue = true;
+	};
+
+	TArray<FString> UsageNames;
+	const int32 VertexFactoryCount = GetVertexFactoryCount(BaseMaterial, &UsageNames);
+	const int32 QualityLevelCount = GetQualityLevelCount(BaseMaterial);
+
+	if (const UMaterial* Material = Cast<UMaterial>(MaterialInterface))
+	{
+		TArray<FName> Switches;
+		TArray<FName> ComponentMasks;
+		GetStaticParameterNames(Material, /*bOverriddenOnly=*/false, Switches, ComponentMasks);
+
+		const int32 NumStaticParameters = Switches.Num() + ComponentMasks.Num();
+		if (NumStaticParameters > DevSettings->MaximumMaterialStaticSwitches)
+		{
+			TArray<FName> StaticParameters = Switches;
+			StaticParameters.Append(ComponentMasks);
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.MaterialPermutation.Switches", "Material exposes {0} static parameters, the budget is {1}. Every combination instances use compiles its own shaders: {2}"),
+				NumStaticParameters,
+				DevSettings->MaximumMaterialStaticSwitches,
+				FText::FromString(JoinNames(StaticParameters))));
+		}
+
+		// Worst case, every combination of static parameters ends up used by some instance
+		const double Permutations = VertexFactoryCount * QualityLevelCount * FMath::Pow(2.0, Switches.Num()) * FMath::Pow(ComponentMaskCombinations, ComponentMasks.Num());
+		if (Permutations > DevSettings->MaximumMaterialPermutations)
+		{
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.MaterialPermutation.Permutations", "Material can compile up to {0} shader permutations, the budget is {1}: {2} vertex factories ({3}) x {4} quality levels x {5} static switches x {6} component masks."),
+				FText::AsNumber(Permutations),
+				DevSettings->MaximumMaterialPermutations,
+				VertexFactoryCount,
+				FText::FromString(UsageNames.IsEmpty() ? TEXT("static mesh only") : FString::Join(UsageNames, TEXT(", "))),
+				QualityLevelCount,
+				Switches.Num(),
+				ComponentMasks.Num()));
+		}
+	}
+	else if (const UMaterialInstance* MaterialInstance = Cast<UMaterialInstance>(MaterialInterface))
+	{
+		// Only set when the overrides differ from the parent, otherwise the parent's shaders are shared
+		if (DevSettings->bFlagMaterialInstanceStaticOverrides && MaterialInstance->bHasStaticPermutationResource)
+		{
+			TArray<FName> Switches;
+			TArray<FName> ComponentMasks;
+			GetStaticParameterNames(MaterialInstance, /*bOverriddenOnly=*/true, Switches, ComponentMasks);
+			Switches.Append(ComponentMasks);
+
+			// Also set by base property and material layer overrides
+			TArray<FName> BasePropertyOverrides;
+			GetBasePropertyOverrideNames(MaterialInstance, BasePropertyOverrides);
+
+			if (!Switches.IsEmpty())
+			{
+				AddMessage(FText::Format(
+					LOCTEXT("CommonValidators.MaterialPermutation.InstanceOverrides", "Material instance overrides static parameters ({0}) and compiles its own {1} shader permutations instead of sharing {2}'s. Use a dynamic parameter, or a separate parent material shared by all instances needing these values."),
+					FText::FromString(JoinNames(Switches)),
+					VertexFactoryCount * QualityLevelCount,
+					FText::FromString(BaseMaterial->GetName())));
+			}
+			else if (!BasePropertyOverrides.IsEmpty())
+			{
+				AddMessage(FText::Format(
+					LOCTEXT("CommonValidators.MaterialPermutation.InstanceBaseOverrides", "Material instance overrides base properties ({0}) and compiles its own {1} shader permutations instead of sharing {2}'s. Use a separate parent material shared by all instances needing these values."),
+					FText::FromString(JoinNames(BasePropertyOverrides)),
+					VertexFactoryCount * QualityLevelCount,
+					FText::FromString(BaseMaterial->GetName())));
+			}
+		}
+	}
+
+	return (bFoundIssue && DevSettings->bErrorOnMaterialPermutations) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+int32 UEditorValidator_MaterialPermutation::GetVertexFactoryCount(const UMaterial* Material, TArray<FString>* OutUsageNames)
+{
+	int32 Count = 1;
+	for (int32 Usage = 0; Usage < MATUSAGE_MAX; ++Usage)
+	{
+		// Static lighting changes the light map policy, not the vertex factory
+		if (Usage == MATUSAGE_StaticLighting || !Material->GetUsageByFlag(static_cast<EMaterialUsage>(Usage)))
+		{
+			continue;
+		}
+
+		++Count;
+		if (OutUsageNames)
+		{
+			OutUsageNames->Add(UMaterial::GetUsageName(static_cast<EMaterialUsage>(Usage)));
+		}
+	}
+	return Count;
+}
+
+int32 UEditorValidator_MaterialPermutation::GetQualityLevelCount(const UMaterial* Material)
+{
+	int32 Count = 0;
+	for (const bool bIsUsed : Material->GetCachedExpressionData().QualityLevelsUsed)
+	{
+		Count += bIsUsed ? 1 : 0;
+	}
+	return FMath::Max(1, Count);
+}
+
+void UEditorValidator_MaterialPermutation::GetStaticParameterNames(const UMaterialInterface* Material, bool bOverriddenOnly, TArray<FName>& OutSwitches, TArray<FName>& OutComponentMasks)
+{
+	auto Collect = [Material, bOverriddenOnly](EMaterialParameterType Type, TArray<FName>& OutNames)
+	{
+		TArray<FMaterialParameterInfo> ParameterInfos;
+		TArray<FGuid> ParameterIds;
+		Material->GetAllParameterInfoOfType(Type, ParameterInfos, ParameterIds);
+
+		for (const FMaterialParameterInfo& ParameterInfo : ParameterInfos)
+		{
+			FMaterialParameterMetadata Metadata;
+			if (!bOverriddenOnly || Material->GetParameterValue(Type, ParameterInfo, Metadata, EMaterialGetParameterValueFlags::CheckInstanceOverrides))
+			{
+				OutNames.Add(ParameterInfo.Name);
+			}
+		}
+	};
+
+	Collect(EMaterialParameterType::StaticSwitch, OutSwitches);
+	Collect(EMaterialParameterType::StaticComponentMask, OutComponentMasks);
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_MaterialPermutation.generated.h"
+
+class UMaterial;
+class UMaterialInterface;
+
+/**
+ * Estimates shader permutations of materials without compiling them: one vertex factory per usage flag, times the quality
+ * levels used by quality switches, times the combinations of static switches and component masks the material exposes.
+ * Also flags material instances that override static parameters, since each of those compiles its own set of shaders.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_MaterialPermutation : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+public:
+	// Vertex factories the material compiles for, the default static mesh one plus one per usage flag
+	static int32 GetVertexFactoryCount(const UMaterial* Material, TArray<FString>* OutUsageNames = nullptr);
+
+	// Quality levels with their own shaders, 1 without quality switches
+	static int32 GetQualityLevelCount(const UMaterial* Material);
+
+	// Static switch and component mask parameters, overridden ones only when bOverriddenOnly
+	static void GetStaticParameterNames(const UMaterialInterface* Material, bool bOverriddenOnly, TArray<FName>& OutSwitches, TArray<FName>& OutComponentMasks);
+};
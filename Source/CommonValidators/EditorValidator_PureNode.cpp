@@ -6,199 +6,21 @@
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraphSchema_K2.h"
 #include "K2Node_CallFunction.h"
-#include "K2Node_BreakStruct.h"
-#include "K2Node_Variable.h"
+#include "Kismet2/BlueprintEditorUtils.h"
 #include "CommonValidatorsStatics.h"
 #include "CommonValidatorsDeveloperSettings.h"
 #include "K2Node.h"
+#include "BlueprintGraphSnapshot.h"
 
 namespace UE::Internal::PureNodeValidatorHelpers
 {
-	bool IsHarmlessPureNode(UK2Node_CallFunction* CallNode)
-	{
-		if (!CallNode) return false;
-
-		UFunction* Func = CallNode->GetTargetFunction();
-		if (!Func)
-		{
-			return false;
-		}
-
-		if (Func->HasMetaData(TEXT("NativeBreakFunc")) || Func->HasMetaData(TEXT("NativeMakeFunc")))
-		{
-			return true;
-		}
-
-		UClass* OwnerClass = Func->GetOuterUClass();
-		if (!OwnerClass)
-		{
-			return false;
-		}
-		
-		const FString OwnerName = OwnerClass->GetName();
-
-		if (OwnerName.Contains(TEXT("KismetMathLibrary")) ||
-			OwnerName.Contains(TEXT("KismetSystemLibrary")) ||
-			OwnerName.Contains(TEXT("KismetTextLibrary")) ||
-			OwnerName.Contains(TEXT("KismetStringTableLibrary")) ||
-			OwnerName.Contains(TEXT("KismetRenderingLibrary")) ||
-			OwnerName.Contains(TEXT("KismetMaterialLibrary")) ||
-			OwnerName.Contains(TEXT("KismetInternationalizationLibrary")) ||
-			OwnerName.Contains(TEXT("KismetInputLibrary")) ||
-			OwnerName.Contains(TEXT("KismetGuidLibrary")) ||
-			OwnerName.Contains(TEXT("KismetArrayLibrary")) ||
-			OwnerName.Contains(TEXT("GameplayStatics")) ||
-			OwnerName.Contains(TEXT("DataTableFunctionLibrary")) ||
-			OwnerName.Contains(TEXT("BlueprintSetLibrary")) ||
-			OwnerName.Contains(TEXT("BlueprintPlatformLibrary")) ||
-			OwnerName.Contains(TEXT("BlueprintPathsLibrary")) ||
-			OwnerName.Contains(TEXT("BlueprintMapLibrary")) ||
-			OwnerName.Contains(TEXT("BlueprintInstancedStructLibrary")) ||
-			OwnerName.Contains(TEXT("KismetNodeHelperLibrary")))
-		{
-			return true;
-		}
-
-		//TODO: Allow users to expand the list above? --KaosSpectrum
-		//Maybe find a better way (though i can't think of one...)
-		
-
-		return false;
-	}
-	
-    // Finds every event/function entry (no incoming exec) in the graph.
-    static void CollectExecEntries(UEdGraph* Graph, TSet<UEdGraphNode*>& OutEntries)
-    {
-        for (UEdGraphNode* Node : Graph->Nodes)
-        {
-            if (Node->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input) == nullptr)
-            {
-                OutEntries.Add(Node);
-            }
-        }
-    }
-
-    // Marks all nodes reachable via exec pins from those entries.
-    static void CollectReachableExecNodes(UEdGraph* Graph, TSet<UEdGraphNode*>& OutReachable)
+    static FText GetMultiExecText(UK2Node_CallFunction* CallNode)
     {
-        TSet<UEdGraphNode*> Visited;
-        TArray<UEdGraphNode*> Queue;
-
-        CollectExecEntries(Graph, Visited);
-        for (UEdGraphNode* Entry : Visited)
-        {
-            Queue.Add(Entry);
-        }
-
-        while (Queue.Num() > 0)
-        {
-            UEdGraphNode* Current = Queue.Pop();
-            OutReachable.Add(Current);
-
-            for (UEdGraphPin* Pin : Current->Pins)
-            {
-                if (Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec && Pin->Direction == EGPD_Output)
-                {
-                    for (UEdGraphPin* Link : Pin->LinkedTo)
-                    {
-                        UEdGraphNode* Next = Link->GetOwningNode();
-                        if (!Visited.Contains(Next))
-                        {
-                            Visited.Add(Next);
-                            Queue.Add(Next);
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Walks the data‑pin graph until the first connected exec‑input is found.
-    static UEdGraphNode* FindFirstImpureSink(UEdGraphNode* StartNode)
-    {
-        TSet<UEdGraphNode*> Visited;
-        TArray<UEdGraphNode*> Queue = { StartNode };
-
-        while (Queue.Num() > 0)
-        {
-            UEdGraphNode* Current = Queue.Pop();
-            if (Visited.Contains(Current))
-            {
-                continue;
-            }
-            Visited.Add(Current);
-
-            if (UEdGraphPin* ExecIn = Current->FindPin(UEdGraphSchema_K2::PN_Execute, EGPD_Input))
-            {
-                if (ExecIn->LinkedTo.Num() > 0)
-                {
-                    return Current;
-                }
-            }
-
-            for (UEdGraphPin* Pin : Current->Pins)
-            {
-                if (Pin->Direction == EGPD_Output && Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
-                {
-                    for (UEdGraphPin* Link : Pin->LinkedTo)
-                    {
-                        Queue.Add(Link->GetOwningNode());
-                    }
-                    for (UEdGraphPin* Sub : Pin->SubPins)
-                    {
-                        for (UEdGraphPin* Link : Sub->LinkedTo)
-                        {
-                            Queue.Add(Link->GetOwningNode());
-                        }
-                    }
-                }
-            }
-        }
-
-        return nullptr;
-    }
-
-    bool WillPureNodeFireMultipleTimes(UK2Node* PureFunctionNode, UEdGraph* Graph)
-    {
-        TSet<UEdGraphNode*> Reachable;
-        CollectReachableExecNodes(Graph, Reachable);
-
-        TSet<UEdGraphNode*> DataConsumers;
-        for (UEdGraphPin* Pin : PureFunctionNode->Pins)
-        {
-            if (Pin->Direction != EGPD_Output || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
-            {
-                continue;
-            }
-
-            for (UEdGraphPin* Link : Pin->LinkedTo)
-            {
-                DataConsumers.Add(Link->GetOwningNode());
-            }
-            for (UEdGraphPin* Sub : Pin->SubPins)
-            {
-                for (UEdGraphPin* Link : Sub->LinkedTo)
-                {
-                    DataConsumers.Add(Link->GetOwningNode());
-                }
-            }
-        }
-
-        TSet<UEdGraphNode*> ExecSinks;
-        for (UEdGraphNode* Consumer : DataConsumers)
-        {
-            UEdGraphNode* Sink = FindFirstImpureSink(Consumer);
-            if (Sink != nullptr && Reachable.Contains(Sink))
-            {
-                ExecSinks.Add(Sink);
-                if (ExecSinks.Num() > 1)
-                {
-                    return true;
-                }
-            }
-        }
-
-        return false;
+        return FText::Format(
+            NSLOCTEXT("PureNodeValidator", "MultiCallWarning",
+                      "{0} will execute more than once. Convert to exec or avoid using across multiple exec nodes."),
+            CallNode->GetNodeTitle(ENodeTitleType::MenuTitle)
+        );
     }
 } // namespace UE::Internal::PureNodeValidatorHelpers
 
@@ -223,71 +45,22 @@ EDataValidationResult UEditorValidator_PureNode::ValidateLoadedAsset_Implementat
 	bool bFoundBadNode = false;
 	bool bShouldError = GetDefault<UCommonValidatorsDeveloperSettings>()->bErrorOnPureNodeMultiExec;
 
-	TArray<UEdGraph*> AllGraphs;
-	AllGraphs.Append(Blueprint->FunctionGraphs);
-	AllGraphs.Append(Blueprint->UbergraphPages);
-	
-    for (UEdGraph* Graph : AllGraphs)
-    {
-        for (UEdGraphNode* Node : Graph->Nodes)
-        {
-            if (Node->IsA<UK2Node_BreakStruct>() || Node->IsA<UK2Node_Variable>())
-            {
-                continue;
-            }
-
-            UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
-            if (CallNode == nullptr)
-            {
-                continue;
-            }
-
-            if (UFunction* TargetFunc = CallNode->GetTargetFunction())
-            {
-                if (TargetFunc->HasMetaData(TEXT("NativeBreakFunc")) ||
-                    TargetFunc->HasMetaData(TEXT("NativeMakeFunc")))
-                {
-                    continue;
-                }
-            }
+	TArray<TPair<UEdGraph*, UK2Node_CallFunction*>> MultiExecNodes;
+	FindMultiExecPureNodes(Blueprint, MultiExecNodes);
 
-            if (!CallNode->IsNodePure() || UE::Internal::PureNodeValidatorHelpers::IsHarmlessPureNode(CallNode))
-            {
-                continue;
-            }
-
-            if (UE::Internal::PureNodeValidatorHelpers::WillPureNodeFireMultipleTimes(CallNode, Graph))
-            {
-                const FText Title = CallNode->GetNodeTitle(ENodeTitleType::MenuTitle);
-                const FText Message = FText::Format(
-                    NSLOCTEXT("PureNodeValidator", "MultiCallWarning",
-                              "{0} will execute more than once. Convert to exec or avoid using across multiple exec nodes."),
-                    Title
-                );
-                CallNode->ErrorMsg            = Message.ToString();
-                CallNode->ErrorType           = bShouldError ? EMessageSeverity::Error : EMessageSeverity::Warning;
-                CallNode->bHasCompilerMessage = true;
-
-                TSharedRef<FTokenizedMessage> TokenMessage =
-                    FTokenizedMessage::Create(EMessageSeverity::Warning, Message);
+    for (const TPair<UEdGraph*, UK2Node_CallFunction*>& MultiExecNode : MultiExecNodes)
+    {
+        UEdGraph* Graph = MultiExecNode.Key;
+        UK2Node_CallFunction* CallNode = MultiExecNode.Value;
 
-                TokenMessage->AddToken(
-                    FActionToken::Create(
-                        NSLOCTEXT("PureNodeValidator", "OpenNode", "Focus Node"),
-                        NSLOCTEXT("PureNodeValidator", "OpenNodeTooltip", "Open this node in the Blueprint Editor"),
-                        FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, CallNode]()
-                        {
-                            UCommonValidatorsStatics::OpenBlueprintAndFocusNode(Blueprint, Graph, CallNode);
-                        }),
-                        /*bEnabled=*/false
-                    )
-                );
+        TSharedRef<FTokenizedMessage> TokenMessage = CreateMultiExecMessage(Blueprint, Graph, CallNode);
+        CallNode->ErrorMsg            = UE::Internal::PureNodeValidatorHelpers::GetMultiExecText(CallNode).ToString();
+        CallNode->ErrorType           = bShouldError ? EMessageSeverity::Error : EMessageSeverity::Warning;
+        CallNode->bHasCompilerMessage = true;
 
-                Context.AddMessage(TokenMessage);
-                Graph->NotifyNodeChanged(Node);
-				bFoundBadNode = true;
-            }
-        }
+        Context.AddMessage(TokenMessage);
+        Graph->NotifyNodeChanged(CallNode);
+        bFoundBadNode = true;
     }
 
 	if (bShouldError && bFoundBadNode)
@@ -297,3 +70,77 @@ EDataValidationResult UEditorValidator_PureNode::ValidateLoadedAsset_Implementat
 	
     return EDataValidationResult::Valid;
 }
+
+void UEditorValidator_PureNode::FindMultiExecPureNodes(UBlueprint* Blueprint, TArray<TPair<UEdGraph*, UK2Node_CallFunction*>>& OutNodes)
+{
+	// Shared with the other graph validators of the validation pass
+	const TSharedRef<const FBlueprintGraphAnalysisCache::FEntry> Analysis = FBlueprintGraphAnalysisCache::Get().FindOrAnalyze(Blueprint);
+	const FBlueprintGraphSnapshot& Snapshot = Analysis->Snapshot;
+	const FBlueprintGraphSnapshotSource& Source = Analysis->Source;
+
+	for (int32 NodeIndex : Analysis->Result.MultiExecPureNodes)
+	{
+		UEdGraph* Graph = Source.Graphs[Snapshot.Nodes[NodeIndex].Graph].Get();
+		UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Source.Nodes[NodeIndex].Get());
+		if (Graph && CallNode)
+		{
+			OutNodes.Add({ Graph, CallNode });
+		}
+	}
+}
+
+void UEditorValidator_PureNode::FindExecSinks(UK2Node* PureNode, UEdGraph* Graph, TArray<UEdGraphNode*>& OutSinks, int32* OutNumEvaluations)
+{
+	FBlueprintGraphSnapshot Snapshot;
+	FBlueprintGraphSnapshotSource Source;
+	FBlueprintGraphAnalysis::BuildSnapshot(FBlueprintEditorUtils::FindBlueprintForGraph(Graph), MakeArrayView(&Graph, 1), Snapshot, &Source);
+
+	const int32 PureNodeIndex = Source.FindNodeIndex(PureNode);
+	if (PureNodeIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	TArray<int32> SinkIndices;
+	FBlueprintGraphAnalysis::FindExecSinks(Snapshot, PureNodeIndex, SinkIndices, OutNumEvaluations);
+	for (int32 SinkIndex : SinkIndices)
+	{
+		// The snapshot also holds the collapsed and macro graphs it sees through, only sinks in Graph can be rewired
+		if (Snapshot.Nodes[SinkIndex].Graph == Snapshot.Nodes[PureNodeIndex].Graph)
+		{
+			OutSinks.AddUnique(Source.Nodes[SinkIndex].Get());
+		}
+	}
+}
+
+TSharedRef<FTokenizedMessage> UEditorValidator_PureNode::CreateMultiExecMessage(UBlueprint* Blueprint, UEdGraph* Graph, UK2Node_CallFunction* CallNode)
+{
+    TSharedRef<FTokenizedMessage> TokenMessage =
+        FTokenizedMessage::Create(EMessageSeverity::Warning, UE::Internal::PureNodeValidatorHelpers::GetMultiExecText(CallNode));
+
+    TokenMessage->AddToken(
+        FActionToken::Create(
+            NSLOCTEXT("PureNodeValidator", "OpenNode", "Focus Node"),
+            NSLOCTEXT("PureNodeValidator", "OpenNodeTooltip", "Open this node in the Blueprint Editor"),
+            FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, CallNode]()
+            {
+                UCommonValidatorsStatics::OpenBlueprintAndFocusNode(Blueprint, Graph, CallNode);
+            }),
+            /*bEnabled=*/false
+        )
+    );
+
+    TokenMessage->AddToken(
+        FActionToken::Create(
+            NSLOCTEXT("PureNodeValidator", "CacheResult", "Cache Result In Variable"),
+            NSLOCTEXT("PureNodeValidator", "CacheResultTooltip", "Evaluate this node once into a variable before its first use and read the variable everywhere else"),
+            FOnActionTokenExecuted::CreateLambda([Blueprint, Graph, CallNode]()
+            {
+                UCommonValidatorsStatics::CachePureNodeResult(Blueprint, Graph, CallNode);
+            }),
+            /*bInSingleUse=*/true
+        )
+    );
+
+    return TokenMessage;
+}
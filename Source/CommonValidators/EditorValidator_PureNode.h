@@ -4,6 +4,12 @@
 #include "EditorValidatorBase.h"
 #include "EditorValidator_PureNode.generated.h"
 
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+class UK2Node_CallFunction;
+class FTokenizedMessage;
+
 /**
  *
  */
@@ -14,4 +20,15 @@ class COMMONVALIDATORS_API UEditorValidator_PureNode : public UEditorValidatorBa
 
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+public:
+	// Every non-harmless pure call in the blueprint's function and event graphs that is evaluated by more than one exec node
+	static void FindMultiExecPureNodes(UBlueprint* Blueprint, TArray<TPair<UEdGraph*, UK2Node_CallFunction*>>& OutNodes);
+
+	// The reachable exec nodes that each evaluate PureNode, in no particular order.
+	// A collapsed node or macro instance stands in for its inner sinks, which OutNumEvaluations counts separately.
+	static void FindExecSinks(class UK2Node* PureNode, UEdGraph* Graph, TArray<UEdGraphNode*>& OutSinks, int32* OutNumEvaluations = nullptr);
+
+	// Warning with focus and cache actions for a pure call found by FindMultiExecPureNodes
+	static TSharedRef<FTokenizedMessage> CreateMultiExecMessage(UBlueprint* Blueprint, UEdGraph* Graph, UK2Node_CallFunction* CallNode);
 };
\ No newline at end of file
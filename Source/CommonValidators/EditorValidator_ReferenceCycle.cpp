@@ -0,0 +1,332 @@
+// This Header
+#include "EditorValidator_ReferenceCycle.h"
+
+// Unreal
+#include "Algo/StableSort.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDependencySnapshot.h"
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_ReferenceCycle)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+namespace UE::Internal::ReferenceCycleValidatorHelpers
+{
+	// Ranking re-runs the component search once per edge, above this many edges only the cycle itself is reported
+	static constexpr int32 MaximumRankedEdges = 1024;
+
+	// How many members are listed in the cycle message
+	static constexpr int32 MaximumListedMembers = 10;
+
+	// Size of the largest strongly connected component, EdgesOf returns local adjacency
+	static uint64 GetLargestComponentSize(int32 NumNodes, TFunctionRef<TConstArrayView<int32>(int32)> EdgesOf, const TArray<uint64>& NodeSizes)
+	{
+		TArray<int32> ComponentOfNode;
+		const int32 NumComponents = FCommonValidatorsDependencyGraph::FindStronglyConnectedComponents(NumNodes, EdgesOf, ComponentOfNode);
+
+		TArray<uint64> ComponentSizes;
+		ComponentSizes.SetNumZeroed(NumComponents);
+		for (int32 Node = 0; Node < NumNodes; ++Node)
+		{
+			ComponentSizes[ComponentOfNode[Node]] += NodeSizes[Node];
+		}
+
+		uint64 LargestSize = 0;
+		TArray<int32> ComponentMemberCounts;
+		ComponentMemberCounts.SetNumZeroed(NumComponents);
+		for (int32 Node = 0; Node < NumNodes; ++Node)
+		{
+			++ComponentMemberCounts[ComponentOfNode[Node]];
+		}
+
+		// A single package on its own isn't a cycle
+		for (int32 Component = 0; Component < NumComponents; ++Component)
+		{
+			if (ComponentMemberCounts[Component] > 1)
+			{
+				LargestSize = FMath::Max(LargestSize, ComponentSizes[Component]);
+			}
+		}
+
+		return LargestSize;
+	}
+
+	struct FRankedCycle
+	{
+		TArray<int32> Members;
+		TArray<UEditorValidator_ReferenceCycle::FCycleEdge> RankedEdges;
+	};
+
+	// Every member of a cycle finds the same cycle, so it is ranked once per snapshot version instead of once per member
+	struct FRankedCycleCache
+	{
+		uint32 SnapshotVersion = 0;
+		// Cycles keyed by their lowest member package index
+		TMap<int32, FRankedCycle> Cycles;
+		// Key of the cycle each member package belongs to
+		TMap<int32, int32> CycleKeyOfPackage;
+
+		static FRankedCycleCache& Get()
+		{
+			static FRankedCycleCache Instance;
+			return Instance;
+		}
+
+		const FRankedCycle* Find(uint32 InSnapshotVersion, int32 PackageIndex)
+		{
+			if (SnapshotVersion != InSnapshotVersion)
+			{
+				SnapshotVersion = InSnapshotVersion;
+				Cycles.Reset();
+				CycleKeyOfPackage.Reset();
+				return nullptr;
+			}
+
+			const int32* CycleKey = CycleKeyOfPackage.Find(PackageIndex);
+			return CycleKey ? Cycles.Find(*CycleKey) : nullptr;
+		}
+
+		void Add(FRankedCycle&& Cycle)
+		{
+			const int32 CycleKey = FMath::Min(Cycle.Members);
+			for (const int32 Member : Cycle.Members)
+			{
+				CycleKeyOfPackage.Add(Member, CycleKey);
+			}
+			Cycles.Add(CycleKey, MoveTemp(Cycle));
+		}
+	};
+} // namespace UE::Internal::ReferenceCycleValidatorHelpers
+
+
+bool UEditorValidator_ReferenceCycle::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableReferenceCycleValidator;
+	return bIsValidatorEnabled && InObject && InObject->IsA<UBlueprint>();
+}
+
+EDataValidationResult UEditorValidator_ReferenceCycle::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const UCommonValidatorsDeveloperSettings* const DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	FCommonValidatorsDependencySnapshot& Snapshot = FCommonValidatorsDependencySnapshot::Get();
+	if (!Snapshot.EnsureReady(AssetRegistry))
+	{
+		return EDataValidationResult::NotValidated;
+	}
+
+	const FCommonValidatorsDependencyGraph& Graph = Snapshot.GetGraph();
+	const int32 RootIndex = Graph.FindPackageIndex(InAssetData.PackageName);
+	if (RootIndex == INDEX_NONE)
+	{
+		return EDataValidationResult::NotValidated;
+	}
+
+	using UE::Internal::ReferenceCycleValidatorHelpers::FRankedCycle;
+	using UE::Internal::ReferenceCycleValidatorHelpers::FRankedCycleCache;
+
+	FRankedCycleCache& CycleCache = FRankedCycleCache::Get();
+	const FRankedCycle* Cycle = CycleCache.Find(Snapshot.GetVersion(), RootIndex);
+	if (!Cycle)
+	{
+		FRankedCycle NewCycle;
+		FindCycle(Graph, RootIndex, NewCycle.Members, NewCycle.RankedEdges);
+		if (NewCycle.Members.IsEmpty())
+		{
+			return EDataValidationResult::Valid;
+		}
+
+		CycleCache.Add(MoveTemp(NewCycle));
+		Cycle = CycleCache.Find(Snapshot.GetVersion(), RootIndex);
+		check(Cycle);
+	}
+
+	const TArray<int32>& Members = Cycle->Members;
+	const TArray<FCycleEdge>& RankedEdges = Cycle->RankedEdges;
+
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnReferenceCycle ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+
+	uint64 TotalSize = 0;
+	TArray<FString> MemberNames;
+	for (const int32 Member : Members)
+	{
+		TotalSize += Graph.GetPackageSize(Member);
+		if (Member != RootIndex && MemberNames.Num() < UE::Internal::ReferenceCycleValidatorHelpers::MaximumListedMembers)
+		{
+			MemberNames.Add(Graph.GetPackageName(Member).ToString());
+		}
+	}
+	if (Members.Num() - 1 > MemberNames.Num())
+	{
+		MemberNames.Add(TEXT("..."));
+	}
+
+	Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(InAssetData,
+		FText::Format(
+			LOCTEXT("CommonValidators.ReferenceCycle.Cycle", "Hard reference cycle: {0} and {1} other packages all reference each other and always load together ({2}). Other members: {3}"),
+			FText::FromName(InAssetData.PackageName),
+			Members.Num() - 1,
+			FText::AsMemory(TotalSize),
+			FText::FromString(FString::Join(MemberNames, TEXT(", ")))),
+		Severity));
+
+	if (RankedEdges.IsEmpty())
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(InAssetData,
+			FText::Format(
+				LOCTEXT("CommonValidators.ReferenceCycle.TooLargeToRank", "The cycle has too many references between its members to rank which ones to break (more than {0}). Start with the references of {1} to other members."),
+				UE::Internal::ReferenceCycleValidatorHelpers::MaximumRankedEdges,
+				FText::FromName(InAssetData.PackageName)),
+			Severity));
+	}
+
+	// Link each edge to the referencing asset, that is where the reference has to go
+	const int32 NumReportedEdges = FMath::Min(RankedEdges.Num(), DevSettings->MaximumReportedCycleEdges);
+	for (int32 EdgeIndex = 0; EdgeIndex < NumReportedEdges; ++EdgeIndex)
+	{
+		const FCycleEdge& Edge = RankedEdges[EdgeIndex];
+		const FName FromPackage = Graph.GetPackageName(Edge.From);
+		const FAssetData FromAssetData = UCommonValidatorsStatics::GetMainAssetData(AssetRegistry, FromPackage);
+
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(FromAssetData.IsValid() ? FromAssetData : InAssetData,
+			FText::Format(
+				LOCTEXT("CommonValidators.ReferenceCycle.Edge", "#{0} reference to break: {1} -> {2}. Making it soft breaks {3} out of the cycle."),
+				EdgeIndex + 1,
+				FText::FromName(FromPackage),
+				FText::FromName(Graph.GetPackageName(Edge.To)),
+				FText::AsMemory(Edge.BrokenSize)),
+			Severity));
+	}
+
+	return DevSettings->bErrorOnReferenceCycle ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+void UEditorValidator_ReferenceCycle::FindCycle(const FCommonValidatorsDependencyGraph& Graph, int32 RootIndex, TArray<int32>& OutMembers, TArray<FCycleEdge>& OutRankedEdges)
+{
+	using namespace UE::Internal::ReferenceCycleValidatorHelpers;
+
+	// Closure of the root, in local indices. Local 0 is the root.
+	TArray<int32> PackageOfLocal;
+	TMap<int32, int32> LocalOfPackage;
+	PackageOfLocal.Add(RootIndex);
+	LocalOfPackage.Add(RootIndex, 0);
+
+	for (int32 Local = 0; Local < PackageOfLocal.Num(); ++Local)
+	{
+		for (const int32 Dependency : Graph.GetDependencies(PackageOfLocal[Local]))
+		{
+			if (Graph.IsValidPackage(Dependency) && !LocalOfPackage.Contains(Dependency))
+			{
+				LocalOfPackage.Add(Dependency, PackageOfLocal.Num());
+				PackageOfLocal.Add(Dependency);
+			}
+		}
+	}
+
+	TArray<TArray<int32>> LocalEdges;
+	LocalEdges.SetNum(PackageOfLocal.Num());
+	for (int32 Local = 0; Local < PackageOfLocal.Num(); ++Local)
+	{
+		for (const int32 Dependency : Graph.GetDependencies(PackageOfLocal[Local]))
+		{
+			if (const int32* DependencyLocal = LocalOfPackage.Find(Dependency))
+			{
+				LocalEdges[Local].Add(*DependencyLocal);
+			}
+		}
+	}
+
+	TArray<int32> ComponentOfLocal;
+	FCommonValidatorsDependencyGraph::FindStronglyConnectedComponents(PackageOfLocal.Num(), [&LocalEdges](int32 Local) { return TConstArrayView<int32>(LocalEdges[Local]); }, ComponentOfLocal);
+
+	// Re-index the root's component so ranking only searches the cycle
+	TArray<int32> MemberOfLocal;
+	MemberOfLocal.Init(INDEX_NONE, PackageOfLocal.Num());
+	TArray<int32> LocalOfMember;
+	for (int32 Local = 0; Local < PackageOfLocal.Num(); ++Local)
+	{
+		if (ComponentOfLocal[Local] == ComponentOfLocal[0])
+		{
+			MemberOfLocal[Local] = LocalOfMember.Num();
+			LocalOfMember.Add(Local);
+		}
+	}
+
+	if (LocalOfMember.Num() < 2)
+	{
+		return;
+	}
+
+	const int32 NumMembers = LocalOfMember.Num();
+	TArray<TArray<int32>> MemberEdges;
+	TArray<uint64> MemberSizes;
+	MemberEdges.SetNum(NumMembers);
+	MemberSizes.SetNum(NumMembers);
+	int32 NumEdges = 0;
+
+	for (int32 Member = 0; Member < NumMembers; ++Member)
+	{
+		const int32 Local = LocalOfMember[Member];
+		OutMembers.Add(PackageOfLocal[Local]);
+		MemberSizes[Member] = Graph.GetPackageSize(PackageOfLocal[Local]);
+
+		for (const int32 DependencyLocal : LocalEdges[Local])
+		{
+			if (MemberOfLocal[DependencyLocal] != INDEX_NONE)
+			{
+				MemberEdges[Member].Add(MemberOfLocal[DependencyLocal]);
+				++NumEdges;
+			}
+		}
+	}
+
+	uint64 CycleSize = 0;
+	for (const uint64 MemberSize : MemberSizes)
+	{
+		CycleSize += MemberSize;
+	}
+
+	// Remove each edge in turn and see how big the largest cycle left over is.
+	// Unranked edges would be listed in arbitrary order, so none are returned.
+	if (NumEdges > MaximumRankedEdges)
+	{
+		return;
+	}
+
+	TArray<int32> EdgesWithoutRemoved;
+
+	for (int32 Member = 0; Member < NumMembers; ++Member)
+	{
+		for (int32 EdgeIndex = 0; EdgeIndex < MemberEdges[Member].Num(); ++EdgeIndex)
+		{
+			FCycleEdge& Edge = OutRankedEdges.AddDefaulted_GetRef();
+			Edge.From = PackageOfLocal[LocalOfMember[Member]];
+			Edge.To = PackageOfLocal[LocalOfMember[MemberEdges[Member][EdgeIndex]]];
+
+			EdgesWithoutRemoved = MemberEdges[Member];
+			EdgesWithoutRemoved.RemoveAt(EdgeIndex);
+
+			const uint64 LargestRemaining = GetLargestComponentSize(NumMembers, [&](int32 Node)
+				{
+					return Node == Member ? TConstArrayView<int32>(EdgesWithoutRemoved) : TConstArrayView<int32>(MemberEdges[Node]);
+				}, MemberSizes);
+
+			Edge.BrokenSize = CycleSize - LargestRemaining;
+		}
+	}
+
+	Algo::StableSortBy(OutRankedEdges, &FCycleEdge::BrokenSize, TGreater<>());
+}
+
+#undef LOCTEXT_NAMESPACE
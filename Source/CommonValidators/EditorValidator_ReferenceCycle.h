@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_ReferenceCycle.generated.h"
+
+class FCommonValidatorsDependencyGraph;
+
+/**
+ * Finds the hard reference cycle a blueprint is part of: the strongly connected component of the package dependency
+ * graph containing it. Every member of a cycle loads every other member, so the whole group inflates each closure.
+ * Reports the group with its total size, then the references inside it ranked by how much of the cycle removing each one breaks up.
+ * The ranked cycle is kept for its other members until the dependency snapshot changes.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_ReferenceCycle : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+public:
+	struct FCycleEdge
+	{
+		int32 From = INDEX_NONE;
+		int32 To = INDEX_NONE;
+		// Bytes of the cycle no longer in the largest remaining cycle once this edge is removed
+		uint64 BrokenSize = 0;
+	};
+
+	/**
+	 * Members of the cycle containing RootIndex, empty when it isn't part of one, and the edges between them, best edge to break first.
+	 * No edges are returned when the cycle has too many of them to rank.
+	 * Only what RootIndex reaches is searched, a cycle through the root is always inside its closure.
+	 */
+	static void FindCycle(const FCommonValidatorsDependencyGraph& Graph, int32 RootIndex, TArray<int32>& OutMembers, TArray<FCycleEdge>& OutRankedEdges);
+};
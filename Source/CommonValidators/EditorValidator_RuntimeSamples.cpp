@@ -0,0 +1,146 @@
+// This Header
+#include "EditorValidator_RuntimeSamples.h"
+
+// Unreal
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_Event.h"
+#include "Misc/DataValidation.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsRuntimeSamples.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_RuntimeSamples)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+bool UEditorValidator_RuntimeSamples::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableRuntimeSampleValidator;
+	return bIsValidatorEnabled && InObject && InObject->IsA<UBlueprint>();
+}
+
+EDataValidationResult UEditorValidator_RuntimeSamples::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	UBlueprint* Blueprint = Cast<UBlueprint>(InAsset);
+	if (!Blueprint) return EDataValidationResult::NotValidated;
+
+	TArray<FCommonValidatorsRuntimeSample> Samples;
+	FCommonValidatorsRuntimeSamples::Get().GetSamplesForBlueprint(*Blueprint, Samples);
+	if (Samples.IsEmpty())
+	{
+		return EDataValidationResult::Valid;
+	}
+
+	const UCommonValidatorsDeveloperSettings* DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnRuntimeSamples ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundIssue = false;
+
+	auto AddMessage = [&](const FText& Text, UEdGraph* Graph, UEdGraphNode* Node)
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedNodeMessage(InAssetData, Text, Severity, Blueprint, Graph, Node));
+		bFoundIssue = true;
+	};
+
+	for (const FCommonValidatorsRuntimeSample& Sample : Samples)
+	{
+		UEdGraph* Graph = nullptr;
+
+		if (Sample.Kind == ECommonValidatorsRuntimeSampleKind::SyncLoad)
+		{
+			UEdGraphNode* Node = FindNode(Blueprint, Sample.Node, Graph);
+			if (!Node)
+			{
+				// The node was removed or rebuilt since the sample was taken
+				continue;
+			}
+
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.RuntimeSamples.SyncLoad", "Measured at runtime: {0} in {1} synchronously loaded {2} {3} {3}|plural(one=time,other=times)."),
+				Node->GetNodeTitle(ENodeTitleType::ListView),
+				FText::FromName(Sample.Graph),
+				FText::FromString(Sample.LoadedPackage),
+				Sample.Count), Graph, Node);
+		}
+		else if (Sample.Kind == ECommonValidatorsRuntimeSampleKind::Tick && Sample.Count > 0)
+		{
+			const double AverageMilliseconds = Sample.TotalMilliseconds / Sample.Count;
+			if (AverageMilliseconds <= DevSettings->RuntimeTickBudgetMilliseconds)
+			{
+				continue;
+			}
+
+			UEdGraphNode* Node = FindTickEvent(Blueprint, Graph);
+			if (!Node)
+			{
+				continue;
+			}
+
+			FNumberFormattingOptions Milliseconds;
+			Milliseconds.SetMaximumFractionalDigits(3);
+
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.RuntimeSamples.Tick", "Measured at runtime: Tick took {0} ms on average ({1} ms peak) over {2} ticks, the budget is {3} ms."),
+				FText::AsNumber(AverageMilliseconds, &Milliseconds),
+				FText::AsNumber(Sample.MaxMilliseconds, &Milliseconds),
+				Sample.Count,
+				FText::AsNumber(DevSettings->RuntimeTickBudgetMilliseconds, &Milliseconds)), Graph, Node);
+		}
+	}
+
+	return (bFoundIssue && DevSettings->bErrorOnRuntimeSamples) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+UEdGraphNode* UEditorValidator_RuntimeSamples::FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid, UEdGraph*& OutGraph)
+{
+	if (!NodeGuid.IsValid())
+	{
+		return nullptr;
+	}
+
+	// Includes collapsed and macro graphs, the node may have been moved into one since
+	TArray<UEdGraph*> AllGraphs;
+	Blueprint->GetAllGraphs(AllGraphs);
+
+	for (UEdGraph* Graph : AllGraphs)
+	{
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (Node && Node->NodeGuid == NodeGuid)
+			{
+				OutGraph = Graph;
+				return Node;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+UEdGraphNode* UEditorValidator_RuntimeSamples::FindTickEvent(UBlueprint* Blueprint, UEdGraph*& OutGraph)
+{
+	static const FName EventTickName(TEXT("ReceiveTick"));
+
+	for (UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+			if (EventNode && EventNode->EventReference.GetMemberName() == EventTickName)
+			{
+				OutGraph = Graph;
+				return EventNode;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_RuntimeSamples.generated.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+
+/**
+ * Reports costs measured at runtime by the CommonValidatorsRuntimeSampler module on the blueprint they were measured in:
+ * synchronous package loads triggered from blueprint script and blueprint tick events above the configured budget.
+ * Samples pointing at nodes that no longer exist are skipped, so fixed issues disappear without clearing the samples.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_RuntimeSamples : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+private:
+	static UEdGraphNode* FindNode(UBlueprint* Blueprint, const FGuid& NodeGuid, UEdGraph*& OutGraph);
+	static UEdGraphNode* FindTickEvent(UBlueprint* Blueprint, UEdGraph*& OutGraph);
+};
@@ -0,0 +1,219 @@
+// This Header
+#include "EditorValidator_WidgetBlueprint.h"
+
+// Unreal
+#include "Blueprint/WidgetTree.h"
+#include "Components/Widget.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Composite.h"
+#include "K2Node_Event.h"
+#include "K2Node_MacroInstance.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Misc/DataValidation.h"
+#include "WidgetBlueprint.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_WidgetBlueprint)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+bool UEditorValidator_WidgetBlueprint::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableWidgetBlueprintValidator;
+	return bIsValidatorEnabled && InObject && InObject->IsA<UWidgetBlueprint>();
+}
+
+EDataValidationResult UEditorValidator_WidgetBlueprint::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(InAsset);
+	if (!WidgetBlueprint) return EDataValidationResult::NotValidated;
+
+	const UCommonValidatorsDeveloperSettings* DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnWidgetBlueprint ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundIssue = false;
+
+	auto AddMessage = [&](const FText& Text, UEdGraph* Graph, UEdGraphNode* Node)
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedNodeMessage(InAssetData, Text, Severity, WidgetBlueprint, Graph, Node));
+		bFoundIssue = true;
+	};
+
+	// Bindings, evaluated every frame for every visible instance
+	TArray<FString> BindingDescriptions;
+	for (const FDelegateEditorBinding& Binding : WidgetBlueprint->Bindings)
+	{
+		const bool bIsFunctionBinding = Binding.Kind == EBindingKind::Function;
+		BindingDescriptions.Add(FString::Printf(TEXT("%s.%s -> %s"), *Binding.ObjectName, *Binding.PropertyName.ToString(),
+			bIsFunctionBinding ? *Binding.FunctionName.ToString() : *Binding.SourceProperty.ToString()));
+
+		if (!bIsFunctionBinding)
+		{
+			continue;
+		}
+
+		UEdGraph* const* BindingGraph = WidgetBlueprint->FunctionGraphs.FindByPredicate([&Binding](const UEdGraph* Graph) { return Graph && Graph->GetFName() == Binding.FunctionName; });
+		if (!BindingGraph)
+		{
+			continue;
+		}
+
+		TSet<UEdGraph*> VisitedGraphs;
+		TArray<TPair<UEdGraph*, UEdGraphNode*>> ExpensiveNodes;
+		FindExpensiveNodes(WidgetBlueprint, *BindingGraph, VisitedGraphs, ExpensiveNodes);
+
+		for (const TPair<UEdGraph*, UEdGraphNode*>& ExpensiveNode : ExpensiveNodes)
+		{
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.WidgetBlueprint.ExpensiveBinding", "Binding {0} for {1}.{2} runs {3} every frame while the widget is visible. Update the value from an event instead."),
+				FText::FromName(Binding.FunctionName),
+				FText::FromString(Binding.ObjectName),
+				FText::FromName(Binding.PropertyName),
+				ExpensiveNode.Value->GetNodeTitle(ENodeTitleType::ListView)), ExpensiveNode.Key, ExpensiveNode.Value);
+		}
+	}
+
+	if (BindingDescriptions.Num() > DevSettings->MaximumWidgetBindings)
+	{
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.WidgetBlueprint.Bindings", "Widget has {0} property bindings, the budget is {1}. Each one is evaluated every frame while the widget is visible: {2}"),
+			BindingDescriptions.Num(),
+			DevSettings->MaximumWidgetBindings,
+			FText::FromString(FString::Join(BindingDescriptions, TEXT(", ")))), nullptr, nullptr);
+	}
+
+	// Predicted when the widget is compiled, covers script Tick, native NativeTick, animations and latent actions.
+	// Read from the asset registry tags, the properties themselves aren't public.
+	FString TickPrediction;
+	FString TickPredictionReason;
+	InAssetData.GetTagValue(TEXT("TickPrediction"), TickPrediction);
+	InAssetData.GetTagValue(TEXT("TickPredictionReason"), TickPredictionReason);
+	if (TickPrediction == StaticEnum<EWidgetCompileTimeTickPrediction>()->GetNameStringByValue(static_cast<int64>(EWidgetCompileTimeTickPrediction::WillTick)))
+	{
+		static const FName EventTickName(TEXT("Tick"));
+
+		UEdGraph* TickGraph = nullptr;
+		UEdGraphNode* TickNode = nullptr;
+		for (UEdGraph* Graph : WidgetBlueprint->UbergraphPages)
+		{
+			for (UEdGraphNode* Node : Graph->Nodes)
+			{
+				UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+				if (EventNode && !EventNode->IsAutomaticallyPlacedGhostNode() && EventNode->EventReference.GetMemberName() == EventTickName)
+				{
+					TickGraph = Graph;
+					TickNode = EventNode;
+				}
+			}
+		}
+
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.WidgetBlueprint.Tick", "Widget ticks every frame while visible ({0}). Prefer events or timers, or disable native tick with the DisableNativeTick class metadata."),
+			FText::FromString(TickPredictionReason)), TickGraph, TickNode);
+	}
+
+	if (DevSettings->MaximumWidgetTreeDepth > 0 && WidgetBlueprint->WidgetTree)
+	{
+		FString DeepestPath;
+		const int32 Depth = GetTreeDepth(WidgetBlueprint->WidgetTree->RootWidget, DeepestPath);
+		if (Depth > DevSettings->MaximumWidgetTreeDepth)
+		{
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.WidgetBlueprint.Depth", "Widget hierarchy is {0} levels deep, the budget is {1}. Deepest branch: {2}"),
+				Depth,
+				DevSettings->MaximumWidgetTreeDepth,
+				FText::FromString(DeepestPath)), nullptr, nullptr);
+		}
+	}
+
+	return (bFoundIssue && DevSettings->bErrorOnWidgetBlueprint) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+void UEditorValidator_WidgetBlueprint::FindExpensiveNodes(UWidgetBlueprint* WidgetBlueprint, UEdGraph* Graph, TSet<UEdGraph*>& VisitedGraphs, TArray<TPair<UEdGraph*, UEdGraphNode*>>& OutNodes)
+{
+	bool bAlreadyVisited = false;
+	VisitedGraphs.Add(Graph, &bAlreadyVisited);
+	if (bAlreadyVisited)
+	{
+		return;
+	}
+
+	const TArray<FName>& ExpensiveFunctions = GetDefault<UCommonValidatorsDeveloperSettings>()->ExpensiveWidgetBindingFunctions;
+
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			const FName FunctionName = CallNode->GetFunctionName();
+			if (ExpensiveFunctions.Contains(FunctionName))
+			{
+				OutNodes.Add({ Graph, Node });
+				continue;
+			}
+
+			// Follow calls into the widget's own functions, whatever they do also runs every frame
+			if (CallNode->FunctionReference.IsSelfContext())
+			{
+				UEdGraph* const* CalledGraph = WidgetBlueprint->FunctionGraphs.FindByPredicate([FunctionName](const UEdGraph* FunctionGraph) { return FunctionGraph && FunctionGraph->GetFName() == FunctionName; });
+				if (CalledGraph)
+				{
+					FindExpensiveNodes(WidgetBlueprint, *CalledGraph, VisitedGraphs, OutNodes);
+				}
+			}
+		}
+		else if (UK2Node_Composite* CompositeNode = Cast<UK2Node_Composite>(Node))
+		{
+			// Collapsed nodes run their bound graph inline
+			if (CompositeNode->BoundGraph)
+			{
+				FindExpensiveNodes(WidgetBlueprint, CompositeNode->BoundGraph, VisitedGraphs, OutNodes);
+			}
+		}
+		else if (UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+		{
+			// ForLoop, ForEachLoop, WhileLoop and friends
+			const UEdGraph* MacroGraph = MacroNode->GetMacroGraph();
+			if (MacroGraph && MacroGraph->GetName().Contains(TEXT("Loop")))
+			{
+				OutNodes.Add({ Graph, Node });
+			}
+		}
+	}
+}
+
+int32 UEditorValidator_WidgetBlueprint::GetTreeDepth(UWidget* Widget, FString& OutDeepestPath)
+{
+	if (!Widget)
+	{
+		return 0;
+	}
+
+	// Handles panel children and named slots alike
+	TArray<UWidget*> Children;
+	UWidgetTree::GetChildWidgets(Widget, Children);
+
+	int32 DeepestChildDepth = 0;
+	FString DeepestChildPath;
+	for (UWidget* Child : Children)
+	{
+		FString ChildPath;
+		const int32 ChildDepth = GetTreeDepth(Child, ChildPath);
+		if (ChildDepth > DeepestChildDepth)
+		{
+			DeepestChildDepth = ChildDepth;
+			DeepestChildPath = MoveTemp(ChildPath);
+		}
+	}
+
+	OutDeepestPath = DeepestChildPath.IsEmpty() ? Widget->GetName() : Widget->GetName() + TEXT(" > ") + DeepestChildPath;
+	return DeepestChildDepth + 1;
+}
+
+#undef LOCTEXT_NAMESPACE
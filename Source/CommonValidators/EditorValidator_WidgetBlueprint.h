@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_WidgetBlueprint.generated.h"
+
+class UEdGraph;
+class UEdGraphNode;
+class UWidget;
+class UWidgetBlueprint;
+
+/**
+ * Validates the per-frame cost of widget blueprints: property bindings (evaluated every frame while visible),
+ * expensive calls and loops inside binding functions, widgets that will tick, and deep widget hierarchies.
+ */
+UCLASS()
+class COMMONVALIDATORS_API UEditorValidator_WidgetBlueprint : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+private:
+	// Expensive calls and loops in Graph, in its collapsed graphs and in functions of the same widget it calls
+	static void FindExpensiveNodes(UWidgetBlueprint* WidgetBlueprint, UEdGraph* Graph, TSet<UEdGraph*>& VisitedGraphs, TArray<TPair<UEdGraph*, UEdGraphNode*>>& OutNodes);
+
+	// Number of levels below and including Widget, and the names along the deepest branch
+	static int32 GetTreeDepth(UWidget* Widget, FString& OutDeepestPath);
+};
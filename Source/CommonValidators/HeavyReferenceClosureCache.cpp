@@ -0,0 +1,242 @@
+// This Header
+#include "HeavyReferenceClosureCache.h"
+
+// Unreal
+#include "AssetRegistry/IAssetRegistry.h"
+#include "HAL/IConsoleManager.h"
+#include "Modules/ModuleManager.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDependencySnapshot.h"
+#include "CommonValidatorsStatics.h"
+
+namespace UE::Internal::HeavyReferenceClosureCacheHelpers
+{
+	// Sorted, disjoint, inclusive ranges of component ids
+	using FComponentIntervals = TArray<TPair<int32, int32>>;
+
+	static void UnionIntervals(const FComponentIntervals& A, const FComponentIntervals& B, FComponentIntervals& Out)
+	{
+		Out.Reset(A.Num() + B.Num());
+
+		int32 IndexA = 0;
+		int32 IndexB = 0;
+		while (IndexA < A.Num() || IndexB < B.Num())
+		{
+			const bool bTakeA = IndexB >= B.Num() || (IndexA < A.Num() && A[IndexA].Key <= B[IndexB].Key);
+			const TPair<int32, int32>& Next = bTakeA ? A[IndexA++] : B[IndexB++];
+
+			// Merge overlapping and adjacent ranges
+			if (Out.Num() > 0 && Next.Key <= Out.Last().Value + 1)
+			{
+				Out.Last().Value = FMath::Max(Out.Last().Value, Next.Value);
+			}
+			else
+			{
+				Out.Add(Next);
+			}
+		}
+	}
+
+	static FAutoConsoleCommand BuildClosuresCommand(
+		TEXT("CommonValidators.BuildHeavyReferenceClosures"),
+		TEXT("Computes deduplicated closure sizes for every package in one pass, so the heavy reference validator can skip per-asset walks."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+			if (!FHeavyReferenceClosureCache::Get().Build(AssetRegistry))
+			{
+				UE_LOG(LogCommonValidators, Warning, TEXT("Asset registry is still loading, try again once discovery has finished."));
+			}
+		}));
+} // namespace UE::Internal::HeavyReferenceClosureCacheHelpers
+
+
+FHeavyReferenceClosureCache& FHeavyReferenceClosureCache::Get()
+{
+	static FHeavyReferenceClosureCache Instance;
+	return Instance;
+}
+
+bool FHeavyReferenceClosureCache::Build(IAssetRegistry& AssetRegistry)
+{
+	check(IsInGameThread());
+
+	Reset();
+
+	FCommonValidatorsDependencySnapshot& Snapshot = FCommonValidatorsDependencySnapshot::Get();
+	if (!Snapshot.EnsureReady(AssetRegistry))
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	ComputeClosureSizes();
+
+	// Any change to the registry can move closures, drop everything and let the next batch rebuild
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddLambda([this](const FAssetData&) { Reset(); });
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda([this](const FAssetData&) { Reset(); });
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([this](const FAssetData&, const FString&) { Reset(); });
+	OnAssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddLambda([this](const FAssetData&) { Reset(); });
+
+	bIsBuilt = true;
+
+	UE_LOG(LogCommonValidators, Log, TEXT("Computed heavy reference closures for %d packages in %.2fs."), ClosureSizes.Num(), FPlatformTime::Seconds() - StartTime);
+	return true;
+}
+
+void FHeavyReferenceClosureCache::Reset()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		AssetRegistry->OnAssetUpdated().Remove(OnAssetUpdatedHandle);
+	}
+
+	OnAssetAddedHandle.Reset();
+	OnAssetRemovedHandle.Reset();
+	OnAssetRenamedHandle.Reset();
+	OnAssetUpdatedHandle.Reset();
+
+	ClosureSizes.Reset();
+	bIsBuilt = false;
+}
+
+bool FHeavyReferenceClosureCache::TryGetClosureSize(FName PackageName, uint64& OutSize) const
+{
+	if (!bIsBuilt)
+	{
+		return false;
+	}
+
+	// The snapshot may have grown since, new packages are simply unknown to us
+	const int32 PackageIndex = FCommonValidatorsDependencySnapshot::Get().GetGraph().FindPackageIndex(PackageName);
+	if (!ClosureSizes.IsValidIndex(PackageIndex))
+	{
+		return false;
+	}
+
+	OutSize = ClosureSizes[PackageIndex];
+	return true;
+}
+
+void FHeavyReferenceClosureCache::ComputeClosureSizes()
+{
+	using namespace UE::Internal::HeavyReferenceClosureCacheHelpers;
+
+	const FCommonValidatorsDependencyGraph& Graph = FCommonValidatorsDependencySnapshot::Get().GetGraph();
+	const int32 NumPackages = Graph.Num();
+
+	TArray<int32> ComponentOfPackage;
+	const int32 NumComponents = Graph.FindStronglyConnectedComponents(ComponentOfPackage);
+
+	// Members of each component, grouped with a counting sort
+	TArray<int32> MemberOffsets;
+	TArray<int32> Members;
+	MemberOffsets.SetNumZeroed(NumComponents + 1);
+	for (int32 PackageIndex = 0; PackageIndex < NumPackages; ++PackageIndex)
+	{
+		++MemberOffsets[ComponentOfPackage[PackageIndex] + 1];
+	}
+	for (int32 Component = 0; Component < NumComponents; ++Component)
+	{
+		MemberOffsets[Component + 1] += MemberOffsets[Component];
+	}
+	{
+		TArray<int32> WriteOffsets(MemberOffsets.GetData(), NumComponents);
+		Members.SetNumUninitialized(NumPackages);
+		for (int32 PackageIndex = 0; PackageIndex < NumPackages; ++PackageIndex)
+		{
+			Members[WriteOffsets[ComponentOfPackage[PackageIndex]]++] = PackageIndex;
+		}
+	}
+
+	// Prefix sums of component sizes, so an interval's size is a single subtraction
+	TArray<uint64> SizePrefix;
+	SizePrefix.SetNumZeroed(NumComponents + 1);
+	for (int32 Component = 0; Component < NumComponents; ++Component)
+	{
+		uint64 ComponentSize = 0;
+		for (int32 MemberIndex = MemberOffsets[Component]; MemberIndex < MemberOffsets[Component + 1]; ++MemberIndex)
+		{
+			ComponentSize += Graph.GetPackageSize(Members[MemberIndex]);
+		}
+		SizePrefix[Component + 1] = SizePrefix[Component] + ComponentSize;
+	}
+
+	// Condensed edges, and how many components still need each component's closure
+	TArray<TArray<int32>> ComponentSuccessors;
+	TArray<int32> PendingPredecessors;
+	ComponentSuccessors.SetNum(NumComponents);
+	PendingPredecessors.SetNumZeroed(NumComponents);
+	for (int32 Component = 0; Component < NumComponents; ++Component)
+	{
+		TArray<int32>& Successors = ComponentSuccessors[Component];
+		for (int32 MemberIndex = MemberOffsets[Component]; MemberIndex < MemberOffsets[Component + 1]; ++MemberIndex)
+		{
+			for (const int32 Dependency : Graph.GetDependencies(Members[MemberIndex]))
+			{
+				const int32 DependencyComponent = ComponentOfPackage[Dependency];
+				if (DependencyComponent != Component)
+				{
+					Successors.AddUnique(DependencyComponent);
+				}
+			}
+		}
+
+		for (const int32 Successor : Successors)
+		{
+			++PendingPredecessors[Successor];
+		}
+	}
+
+	// Reverse topological order is simply ascending component id.
+	// Closures are released as soon as the last component depending on them has been processed.
+	TArray<FComponentIntervals> Closures;
+	TArray<uint64> ComponentClosureSizes;
+	Closures.SetNum(NumComponents);
+	ComponentClosureSizes.SetNumZeroed(NumComponents);
+
+	FComponentIntervals Scratch;
+	for (int32 Component = 0; Component < NumComponents; ++Component)
+	{
+		FComponentIntervals& Closure = Closures[Component];
+		Closure.Add({ Component, Component });
+
+		for (const int32 Successor : ComponentSuccessors[Component])
+		{
+			UnionIntervals(Closure, Closures[Successor], Scratch);
+			Swap(Closure, Scratch);
+
+			if (--PendingPredecessors[Successor] == 0)
+			{
+				Closures[Successor].Empty();
+			}
+		}
+
+		uint64 ClosureSize = 0;
+		for (const TPair<int32, int32>& Interval : Closure)
+		{
+			ClosureSize += SizePrefix[Interval.Value + 1] - SizePrefix[Interval.Key];
+		}
+		ComponentClosureSizes[Component] = ClosureSize;
+
+		if (PendingPredecessors[Component] == 0)
+		{
+			Closure.Empty();
+		}
+	}
+
+	// A package's closure is its component's closure, minus itself
+	ClosureSizes.SetNumUninitialized(NumPackages);
+	for (int32 PackageIndex = 0; PackageIndex < NumPackages; ++PackageIndex)
+	{
+		ClosureSizes[PackageIndex] = ComponentClosureSizes[ComponentOfPackage[PackageIndex]] - Graph.GetPackageSize(PackageIndex);
+	}
+}
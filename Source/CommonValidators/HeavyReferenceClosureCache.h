@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IAssetRegistry;
+
+/**
+ * Project-wide deduplicated closure sizes, computed for every package in one pass.
+ *
+ * The hard dependency graph is condensed into strongly connected components, then closures are built
+ * bottom up in reverse topological order as unions of component id intervals. Used by the heavy reference
+ * validator in batch runs so validating N assets doesn't walk N overlapping closures.
+ * Runs over the dependency graph owned by FCommonValidatorsDependencySnapshot.
+ */
+class COMMONVALIDATORS_API FHeavyReferenceClosureCache
+{
+public:
+	static FHeavyReferenceClosureCache& Get();
+
+	// Builds closures for every package. Returns false if the asset registry is still discovering assets.
+	bool Build(IAssetRegistry& AssetRegistry);
+
+	void Reset();
+
+	bool IsBuilt() const { return bIsBuilt; }
+
+	// Size of everything PackageName hard references, excluding the package itself
+	bool TryGetClosureSize(FName PackageName, uint64& OutSize) const;
+
+private:
+	void ComputeClosureSizes();
+
+	// Indexed like the snapshot graph's packages
+	TArray<uint64> ClosureSizes;
+	bool bIsBuilt = false;
+
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnAssetUpdatedHandle;
+};
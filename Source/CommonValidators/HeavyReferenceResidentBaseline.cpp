@@ -0,0 +1,232 @@
+// This Header
+#include "HeavyReferenceResidentBaseline.h"
+
+// Unreal
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/AssetManager.h"
+#include "GameMapsSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDependencySnapshot.h"
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+namespace UE::Internal::HeavyReferenceResidentBaselineHelpers
+{
+	static void AddPath(const FSoftObjectPath& Path, TArray<FName>& OutRootPackages)
+	{
+		// Native classes live in script packages, which are never part of the graph
+		const FName PackageName = Path.GetLongPackageFName();
+		if (!PackageName.IsNone() && !FPackageName::IsScriptPackage(PackageName.ToString()))
+		{
+			OutRootPackages.AddUnique(PackageName);
+		}
+	}
+
+	static FAutoConsoleCommand DumpBaselineCommand(
+		TEXT("CommonValidators.DumpResidentBaseline"),
+		TEXT("Builds the resident baseline subtracted from heavy reference totals and logs its roots and size."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+			FHeavyReferenceResidentBaseline& Baseline = FHeavyReferenceResidentBaseline::Get();
+			if (!Baseline.Build(AssetRegistry))
+			{
+				UE_LOG(LogCommonValidators, Warning, TEXT("Asset registry is still loading, try again once discovery has finished."));
+				return;
+			}
+
+			for (const FName& RootPackage : Baseline.GetRootPackages())
+			{
+				UE_LOG(LogCommonValidators, Display, TEXT("Resident baseline root: %s"), *RootPackage.ToString());
+			}
+			UE_LOG(LogCommonValidators, Display, TEXT("Resident baseline size: %s"), *FText::AsMemory(Baseline.GetSize()).ToString());
+		}));
+} // namespace UE::Internal::HeavyReferenceResidentBaselineHelpers
+
+
+FHeavyReferenceResidentBaseline& FHeavyReferenceResidentBaseline::Get()
+{
+	static FHeavyReferenceResidentBaseline Instance;
+	return Instance;
+}
+
+bool FHeavyReferenceResidentBaseline::Build(IAssetRegistry& AssetRegistry)
+{
+	check(IsInGameThread());
+
+	Reset();
+
+	FCommonValidatorsDependencySnapshot& Snapshot = FCommonValidatorsDependencySnapshot::Get();
+	if (!Snapshot.EnsureReady(AssetRegistry))
+	{
+		return false;
+	}
+
+	const FCommonValidatorsDependencyGraph& Graph = Snapshot.GetGraph();
+
+	GatherRootPackages(RootPackages);
+
+	TArray<int32> RootIndices;
+	for (const FName& RootPackage : RootPackages)
+	{
+		const int32 RootIndex = Graph.FindPackageIndex(RootPackage);
+		if (RootIndex != INDEX_NONE)
+		{
+			RootIndices.Add(RootIndex);
+		}
+		else
+		{
+			UE_LOG(LogCommonValidators, Verbose, TEXT("Resident baseline root %s is not in the dependency graph, skipped."), *RootPackage.ToString());
+		}
+	}
+
+	ResidentPackages.Init(false, Graph.Num());
+	Size = Graph.ComputeReachableSize(RootIndices, [](int32) { return true; }, ResidentPackages);
+
+	for (TConstSetBitIterator<> It(ResidentPackages); It; ++It)
+	{
+		ResidentPackageNames.Add(Graph.GetPackageName(It.GetIndex()));
+	}
+
+	// Only changes that touch resident content move the baseline, saving anything else must not throw it away
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FHeavyReferenceResidentBaseline::OnAssetAdded);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FHeavyReferenceResidentBaseline::OnAssetRemovedOrUpdated);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FHeavyReferenceResidentBaseline::OnAssetRenamed);
+	OnAssetUpdatedHandle = AssetRegistry.OnAssetUpdated().AddRaw(this, &FHeavyReferenceResidentBaseline::OnAssetRemovedOrUpdated);
+
+	bIsBuilt = true;
+
+	UE_LOG(LogCommonValidators, Log, TEXT("Resident baseline has %d roots, %s."), RootIndices.Num(), *FText::AsMemory(Size).ToString());
+	return true;
+}
+
+void FHeavyReferenceResidentBaseline::Reset()
+{
+	if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+	{
+		AssetRegistry->OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry->OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry->OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		AssetRegistry->OnAssetUpdated().Remove(OnAssetUpdatedHandle);
+	}
+
+	OnAssetAddedHandle.Reset();
+	OnAssetRemovedHandle.Reset();
+	OnAssetRenamedHandle.Reset();
+	OnAssetUpdatedHandle.Reset();
+
+	RootPackages.Reset();
+	ResidentPackages.Empty();
+	ResidentPackageNames.Reset();
+	Size = 0;
+	bIsBuilt = false;
+}
+
+bool FHeavyReferenceResidentBaseline::IsResidentPackage(FName PackageName) const
+{
+	return RootPackages.Contains(PackageName) || ResidentPackageNames.Contains(PackageName);
+}
+
+void FHeavyReferenceResidentBaseline::OnAssetAdded(const FAssetData& AssetData)
+{
+	// A new asset of a resident primary asset type is a new root
+	const FPrimaryAssetId PrimaryAssetId = AssetData.GetPrimaryAssetId();
+	if (IsResidentPackage(AssetData.PackageName)
+		|| (PrimaryAssetId.IsValid() && GetDefault<UCommonValidatorsDeveloperSettings>()->ResidentBaselinePrimaryAssetTypes.Contains(PrimaryAssetId.PrimaryAssetType)))
+	{
+		Reset();
+		return;
+	}
+
+	// Resident packages referencing a package that was missing until now pull it in
+	TArray<FName> Referencers;
+	IAssetRegistry::GetChecked().GetReferencers(AssetData.PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::Package,
+		UE::AssetRegistry::EDependencyQuery::Hard | UE::AssetRegistry::EDependencyQuery::Game);
+	if (Referencers.ContainsByPredicate([this](FName Referencer) { return IsResidentPackage(Referencer); }))
+	{
+		Reset();
+	}
+}
+
+void FHeavyReferenceResidentBaseline::OnAssetRemovedOrUpdated(const FAssetData& AssetData)
+{
+	// Non-resident packages aren't reachable from the roots, whatever they reference doesn't matter
+	if (IsResidentPackage(AssetData.PackageName))
+	{
+		Reset();
+	}
+}
+
+void FHeavyReferenceResidentBaseline::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (IsResidentPackage(FName(FPackageName::ObjectPathToPackageName(OldObjectPath))))
+	{
+		Reset();
+		return;
+	}
+
+	OnAssetAdded(AssetData);
+}
+
+void FHeavyReferenceResidentBaseline::CopyResidentPackages(TBitArray<>& OutVisited, int32 NumPackages) const
+{
+	OutVisited = ResidentPackages;
+
+	// The snapshot may have grown since, new packages can't be resident
+	if (OutVisited.Num() < NumPackages)
+	{
+		OutVisited.Add(false, NumPackages - OutVisited.Num());
+	}
+}
+
+void FHeavyReferenceResidentBaseline::GatherRootPackages(TArray<FName>& OutRootPackages)
+{
+	using namespace UE::Internal::HeavyReferenceResidentBaselineHelpers;
+
+	const UCommonValidatorsDeveloperSettings* const DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+
+	if (DevSettings->bIncludeGameDefaultsInResidentBaseline)
+	{
+		AddPath(FSoftObjectPath(UGameMapsSettings::GetGameDefaultMap()), OutRootPackages);
+		AddPath(GetDefault<UGameMapsSettings>()->GameInstanceClass, OutRootPackages);
+		AddPath(FSoftObjectPath(UGameMapsSettings::GetGlobalDefaultGameMode()), OutRootPackages);
+	}
+
+	for (const TSoftObjectPtr<UObject>& ResidentAsset : DevSettings->ResidentBaselineAssets)
+	{
+		AddPath(ResidentAsset.ToSoftObjectPath(), OutRootPackages);
+	}
+
+	if (DevSettings->ResidentBaselinePrimaryAssetTypes.IsEmpty() || !UAssetManager::IsInitialized())
+	{
+		return;
+	}
+
+	UAssetManager& AssetManager = UAssetManager::Get();
+	for (const FPrimaryAssetType& PrimaryAssetType : DevSettings->ResidentBaselinePrimaryAssetTypes)
+	{
+		TArray<FPrimaryAssetId> PrimaryAssetIds;
+		AssetManager.GetPrimaryAssetIdList(PrimaryAssetType, PrimaryAssetIds);
+
+		for (const FPrimaryAssetId& PrimaryAssetId : PrimaryAssetIds)
+		{
+			AddPath(AssetManager.GetPrimaryAssetPath(PrimaryAssetId), OutRootPackages);
+
+			for (const FName& BundleName : DevSettings->ResidentBaselineBundles)
+			{
+				const FAssetBundleEntry BundleEntry = AssetManager.GetAssetBundleEntry(PrimaryAssetId, BundleName);
+				for (const FTopLevelAssetPath& BundleAssetPath : BundleEntry.AssetPaths)
+				{
+					AddPath(FSoftObjectPath(BundleAssetPath), OutRootPackages);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IAssetRegistry;
+struct FAssetData;
+
+/**
+ * Packages the game keeps loaded for the whole session: the hard closure of the startup map, the game instance and
+ * default game mode, the configured resident assets and the always loaded primary assets and bundles.
+ *
+ * Computed once over the dependency graph owned by FCommonValidatorsDependencySnapshot and dropped when a registry change
+ * can move it: a resident package or root changes, or a new package is referenced by one. Saving anything else keeps it.
+ * The heavy reference validator skips these packages, so assets are only charged for what loading them adds.
+ */
+class COMMONVALIDATORS_API FHeavyReferenceResidentBaseline
+{
+public:
+	static FHeavyReferenceResidentBaseline& Get();
+
+	// Resolves the roots and marks their closures. Returns false if the asset registry is still discovering assets.
+	bool Build(IAssetRegistry& AssetRegistry);
+
+	void Reset();
+
+	bool IsBuilt() const { return bIsBuilt; }
+
+	// Resident packages as visited bits for FCommonValidatorsDependencyGraph::ComputeReachableSize, sized for NumPackages
+	void CopyResidentPackages(TBitArray<>& OutVisited, int32 NumPackages) const;
+
+	bool IsResident(int32 PackageIndex) const { return ResidentPackages.IsValidIndex(PackageIndex) && ResidentPackages[PackageIndex]; }
+
+	// Deduplicated size of the roots and everything they hard reference
+	uint64 GetSize() const { return Size; }
+
+	TConstArrayView<FName> GetRootPackages() const { return RootPackages; }
+
+	// Root packages from the developer settings, the game maps settings and the asset manager
+	static void GatherRootPackages(TArray<FName>& OutRootPackages);
+
+private:
+	// Root, or in the closure of one
+	bool IsResidentPackage(FName PackageName) const;
+
+	void OnAssetAdded(const FAssetData& AssetData);
+	void OnAssetRemovedOrUpdated(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+	TArray<FName> RootPackages;
+
+	// Indexed like the snapshot graph's packages
+	TBitArray<> ResidentPackages;
+	// Same packages by name, the graph may already have dropped a removed package when the registry event gets here
+	TSet<FName> ResidentPackageNames;
+	uint64 Size = 0;
+	bool bIsBuilt = false;
+
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnAssetUpdatedHandle;
+};
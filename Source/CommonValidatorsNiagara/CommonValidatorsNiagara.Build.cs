@@ -0,0 +1,19 @@
+using UnrealBuildTool;
+
+public class CommonValidatorsNiagara : ModuleRules
+{
+	public CommonValidatorsNiagara(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"DataValidation",
+			"Niagara",
+			"NiagaraCore",
+			"CommonValidators"
+		});
+	}
+}
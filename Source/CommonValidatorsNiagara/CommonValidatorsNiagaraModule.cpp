@@ -0,0 +1,4 @@
+#include "Modules/ModuleManager.h"
+
+// Only loaded by the CommonValidators module when the Niagara plugin is enabled
+IMPLEMENT_MODULE(FDefaultModuleImpl, CommonValidatorsNiagara)
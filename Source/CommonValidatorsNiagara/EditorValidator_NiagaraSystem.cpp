@@ -0,0 +1,237 @@
+// This Header
+#include "EditorValidator_NiagaraSystem.h"
+
+// Unreal
+#include "Misc/DataValidation.h"
+#include "NiagaraEffectType.h"
+#include "NiagaraEmitter.h"
+#include "NiagaraEmitterHandle.h"
+#include "NiagaraParameterStore.h"
+#include "NiagaraScript.h"
+#include "NiagaraSystem.h"
+
+// Project
+
+// Local
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsStatics.h"
+
+// Gen CPP
+#include UE_INLINE_GENERATED_CPP_BY_NAME(EditorValidator_NiagaraSystem)
+
+#define LOCTEXT_NAMESPACE "CommonValidators"
+
+namespace UE::Internal::NiagaraSystemValidatorHelpers
+{
+	// Module inputs set to constants are stored as rapid iteration parameters named Constants.<Emitter>.<Module>.<Input>
+	static const TCHAR* SpawnRateSuffixes[] = { TEXT("SpawnRate.SpawnRate") };
+	static const TCHAR* LifetimeSuffixes[] = { TEXT("InitializeParticle.Lifetime"), TEXT("InitializeParticle.Lifetime Max") };
+	static const TCHAR* BurstCountSuffixes[] = { TEXT("SpawnBurst_Instantaneous.Spawn Count") };
+
+	static bool CullsInstances(const FNiagaraSystemScalabilitySettings& Settings)
+	{
+		return Settings.bCullByDistance || Settings.bCullMaxInstanceCount || Settings.bCullPerSystemMaxInstanceCount || Settings.bCullByMaxTimeWithoutRender;
+	}
+} // namespace UE::Internal::NiagaraSystemValidatorHelpers
+
+
+bool UEditorValidator_NiagaraSystem::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+{
+	bool bIsValidatorEnabled = GetDefault<UCommonValidatorsDeveloperSettings>()->bEnableNiagaraSystemValidator;
+	return bIsValidatorEnabled && InObject && InObject->IsA<UNiagaraSystem>();
+}
+
+EDataValidationResult UEditorValidator_NiagaraSystem::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	using namespace UE::Internal::NiagaraSystemValidatorHelpers;
+
+	UNiagaraSystem* System = Cast<UNiagaraSystem>(InAsset);
+	if (!System) return EDataValidationResult::NotValidated;
+
+	const UCommonValidatorsDeveloperSettings* DevSettings = GetDefault<UCommonValidatorsDeveloperSettings>();
+	const EMessageSeverity::Type Severity = DevSettings->bErrorOnNiagaraSystem ? EMessageSeverity::Error : EMessageSeverity::PerformanceWarning;
+	bool bFoundIssue = false;
+
+	auto AddMessage = [&](const FText& Text)
+	{
+		Context.AddMessage(UCommonValidatorsStatics::CreateLinkedMessage(InAssetData, Text, Severity));
+		bFoundIssue = true;
+	};
+
+	TArray<FString> DynamicBoundsEmitters;
+
+	for (const FNiagaraEmitterHandle& EmitterHandle : System->GetEmitterHandles())
+	{
+		const FVersionedNiagaraEmitterData* EmitterData = EmitterHandle.GetEmitterData();
+		if (!EmitterHandle.GetIsEnabled() || !EmitterData)
+		{
+			continue;
+		}
+
+		const FText EmitterName = FText::FromName(EmitterHandle.GetName());
+		const UNiagaraScript* EmitterUpdateScript = EmitterData->EmitterUpdateScriptProps.Script;
+		const UNiagaraScript* ParticleSpawnScript = EmitterData->SpawnScriptProps.Script;
+
+		const float SpawnRate = GetMaximumConstantInput(EmitterUpdateScript, SpawnRateSuffixes);
+		if (SpawnRate > DevSettings->MaximumNiagaraSpawnRate)
+		{
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.Niagara.SpawnRate", "Emitter {0} spawns {1} particles per second, the budget is {2}."),
+				EmitterName,
+				FText::AsNumber(SpawnRate),
+				FText::AsNumber(DevSettings->MaximumNiagaraSpawnRate)));
+		}
+
+		// Spawning per unit travelled grows with speed, only a fixed allocation caps it
+		if (EmitterData->AllocationMode != EParticleAllocationMode::FixedCount && HasModuleInput(EmitterUpdateScript, TEXT(".SpawnPerUnit.")))
+		{
+			AddMessage(FText::Format(
+				LOCTEXT("CommonValidators.Niagara.SpawnPerUnit", "Emitter {0} spawns per unit travelled without a particle cap, a fast moving system spawns without limit. Set the allocation mode to Fixed Count."),
+				EmitterName));
+		}
+
+		if (EmitterData->SimTarget == ENiagaraSimTarget::CPUSim)
+		{
+			// Steady state of the constant rate plus the biggest burst, or what the emitter allocates up front
+			const float Lifetime = GetMaximumConstantInput(ParticleSpawnScript, LifetimeSuffixes);
+			const float BurstCount = GetMaximumConstantInput(EmitterUpdateScript, BurstCountSuffixes);
+			float ParticleEstimate = SpawnRate * Lifetime + BurstCount;
+			if (EmitterData->AllocationMode == EParticleAllocationMode::FixedCount)
+			{
+				ParticleEstimate = EmitterData->PreAllocationCount;
+			}
+			else if (EmitterData->AllocationMode == EParticleAllocationMode::ManualEstimate)
+			{
+				ParticleEstimate = FMath::Max(ParticleEstimate, static_cast<float>(EmitterData->PreAllocationCount));
+			}
+
+			if (ParticleEstimate > DevSettings->MaximumNiagaraCPUParticles)
+			{
+				AddMessage(FText::Format(
+					LOCTEXT("CommonValidators.Niagara.CPUParticles", "CPU emitter {0} has an estimated {1} particles, the budget is {2}. Simulate it on the GPU or spawn fewer particles."),
+					EmitterName,
+					FText::AsNumber(FMath::CeilToInt(ParticleEstimate)),
+					DevSettings->MaximumNiagaraCPUParticles));
+			}
+		}
+
+		if (EmitterData->CalculateBoundMode == ENiagaraEmitterCalculateBoundMode::Dynamic)
+		{
+			DynamicBoundsEmitters.Add(EmitterHandle.GetName().ToString());
+		}
+	}
+
+	// Fixed system bounds override every emitter
+	if (DevSettings->bRequireNiagaraFixedBounds && !System->bFixedBounds && DynamicBoundsEmitters.Num() > 0)
+	{
+		AddMessage(FText::Format(
+			LOCTEXT("CommonValidators.Niagara.Bounds", "Bounds are computed from the particles every frame. Set fixed bounds on the system or on these emitters: {0}"),
+			FText::FromString(FString::Join(DynamicBoundsEmitters, TEXT(", ")))));
+	}
+
+	if (DevSettings->bRequireNiagaraScalability)
+	{
+		const UNiagaraEffectType* EffectType = System->GetEffectType();
+		if (!EffectType)
+		{
+			AddMessage(LOCTEXT("CommonValidators.Niagara.EffectType", "System has no effect type, so it has no scalability, culling or significance settings."));
+		}
+		else
+		{
+			if (!HasCulling(System))
+			{
+				AddMessage(FText::Format(
+					LOCTEXT("CommonValidators.Niagara.Culling", "Neither effect type {0} nor the system's scalability overrides cull instances by distance, instance count or time without render."),
+					FText::FromString(EffectType->GetName())));
+			}
+
+			if (!EffectType->SignificanceHandler)
+			{
+				AddMessage(FText::Format(
+					LOCTEXT("CommonValidators.Niagara.Significance", "Effect type {0} has no significance handler, instance count culling can't tell which instances matter most."),
+					FText::FromString(EffectType->GetName())));
+			}
+		}
+	}
+
+	return (bFoundIssue && DevSettings->bErrorOnNiagaraSystem) ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+float UEditorValidator_NiagaraSystem::GetMaximumConstantInput(const UNiagaraScript* Script, TConstArrayView<const TCHAR*> NameSuffixes)
+{
+	if (!Script)
+	{
+		return 0.0f;
+	}
+
+	float Maximum = 0.0f;
+	const FNiagaraParameterStore& Parameters = Script->RapidIterationParameters;
+	for (const FNiagaraVariableWithOffset& Parameter : Parameters.ReadParameterVariables())
+	{
+		const FString ParameterName = Parameter.GetName().ToString();
+		if (!NameSuffixes.ContainsByPredicate([&ParameterName](const TCHAR* Suffix) { return ParameterName.EndsWith(Suffix); }))
+		{
+			continue;
+		}
+
+		if (Parameter.GetType() == FNiagaraTypeDefinition::GetFloatDef())
+		{
+			Maximum = FMath::Max(Maximum, *reinterpret_cast<const float*>(Parameters.GetParameterData(Parameter.Offset)));
+		}
+		else if (Parameter.GetType() == FNiagaraTypeDefinition::GetIntDef())
+		{
+			Maximum = FMath::Max(Maximum, static_cast<float>(*reinterpret_cast<const int32*>(Parameters.GetParameterData(Parameter.Offset))));
+		}
+	}
+
+	return Maximum;
+}
+
+bool UEditorValidator_NiagaraSystem::HasModuleInput(const UNiagaraScript* Script, const TCHAR* ModuleName)
+{
+	if (!Script)
+	{
+		return false;
+	}
+
+	for (const FNiagaraVariableWithOffset& Parameter : Script->RapidIterationParameters.ReadParameterVariables())
+	{
+		if (Parameter.GetName().ToString().Contains(ModuleName))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UEditorValidator_NiagaraSystem::HasCulling(const UNiagaraSystem* System)
+{
+	using namespace UE::Internal::NiagaraSystemValidatorHelpers;
+
+	if (System->bOverrideScalabilitySettings)
+	{
+		for (const FNiagaraSystemScalabilityOverride& Override : System->SystemScalabilityOverrides.Overrides)
+		{
+			if (CullsInstances(Override))
+			{
+				return true;
+			}
+		}
+	}
+
+	if (const UNiagaraEffectType* EffectType = System->GetEffectType())
+	{
+		for (const FNiagaraSystemScalabilitySettings& Settings : EffectType->GetSystemScalabilitySettings().Settings)
+		{
+			if (CullsInstances(Settings))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+#undef LOCTEXT_NAMESPACE
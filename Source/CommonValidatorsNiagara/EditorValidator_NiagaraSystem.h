@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EditorValidator_NiagaraSystem.generated.h"
+
+class UNiagaraScript;
+class UNiagaraSystem;
+
+/**
+ * Validates the simulation cost and scalability setup of Niagara systems: CPU emitters with too many particles,
+ * emitters spawning too fast or without limit, bounds computed every frame, and missing effect type, culling or significance handler.
+ */
+UCLASS()
+class COMMONVALIDATORSNIAGARA_API UEditorValidator_NiagaraSystem : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+private:
+	// Largest constant float module input whose name ends with one of the suffixes, 0 when there is none
+	static float GetMaximumConstantInput(const UNiagaraScript* Script, TConstArrayView<const TCHAR*> NameSuffixes);
+
+	// Whether any constant module input contains the module name, e.g. ".SpawnPerUnit."
+	static bool HasModuleInput(const UNiagaraScript* Script, const TCHAR* ModuleName);
+
+	// Whether the effect type, or the system's own overrides, cull instances in any way
+	static bool HasCulling(const UNiagaraSystem* System);
+};
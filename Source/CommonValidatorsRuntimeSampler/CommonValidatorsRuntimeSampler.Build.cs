@@ -0,0 +1,17 @@
+using UnrealBuildTool;
+
+public class CommonValidatorsRuntimeSampler : ModuleRules
+{
+	public CommonValidatorsRuntimeSampler(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"UnrealEd",
+			"CommonValidators"
+		});
+	}
+}
@@ -0,0 +1,205 @@
+// This Header
+#include "CommonValidatorsRuntimeSampler.h"
+
+// Unreal
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet2/KismetDebugUtilities.h"
+#include "UObject/Script.h"
+#include "UObject/Stack.h"
+#include "UObject/UObjectGlobals.h"
+
+// Project
+#include "CommonValidatorsStatics.h"
+
+// Local
+
+namespace UE::Internal::CommonValidatorsRuntimeSamplerHelpers
+{
+	static FAutoConsoleCommand StartCommand(
+		TEXT("CommonValidators.RuntimeSampler.Start"),
+		TEXT("Starts recording blueprint sync loads and tick costs for the runtime sample validator."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FCommonValidatorsRuntimeSampler::Get().Start();
+		}));
+
+	static FAutoConsoleCommand StopCommand(
+		TEXT("CommonValidators.RuntimeSampler.Stop"),
+		TEXT("Stops recording and merges the samples into Saved/CommonValidators/RuntimeSamples.json."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FCommonValidatorsRuntimeSampler::Get().Stop();
+		}));
+
+	static FAutoConsoleCommand ClearCommand(
+		TEXT("CommonValidators.RuntimeSampler.Clear"),
+		TEXT("Deletes all recorded runtime samples."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			FCommonValidatorsRuntimeSamples::ClearFile();
+		}));
+} // namespace UE::Internal::CommonValidatorsRuntimeSamplerHelpers
+
+
+FCommonValidatorsRuntimeSampler& FCommonValidatorsRuntimeSampler::Get()
+{
+	static FCommonValidatorsRuntimeSampler Instance;
+	return Instance;
+}
+
+void FCommonValidatorsRuntimeSampler::Start()
+{
+	if (bIsRecording)
+	{
+		return;
+	}
+
+#if DO_BLUEPRINT_GUARD
+	OnSyncLoadPackageHandle = FCoreUObjectDelegates::OnSyncLoadPackage.AddRaw(this, &FCommonValidatorsRuntimeSampler::OnSyncLoadPackage);
+	OnEnterScriptContextHandle = FBlueprintContextTracker::OnEnterScriptContext.AddRaw(this, &FCommonValidatorsRuntimeSampler::OnEnterScriptContext);
+	OnExitScriptContextHandle = FBlueprintContextTracker::OnExitScriptContext.AddRaw(this, &FCommonValidatorsRuntimeSampler::OnExitScriptContext);
+	bIsRecording = true;
+
+	UE_LOG(LogCommonValidators, Display, TEXT("Recording runtime samples."));
+#else
+	UE_LOG(LogCommonValidators, Warning, TEXT("Runtime samples need the blueprint script stack, which this build doesn't track (DO_BLUEPRINT_GUARD)."));
+#endif
+}
+
+void FCommonValidatorsRuntimeSampler::Stop()
+{
+	if (!bIsRecording)
+	{
+		return;
+	}
+
+#if DO_BLUEPRINT_GUARD
+	FCoreUObjectDelegates::OnSyncLoadPackage.Remove(OnSyncLoadPackageHandle);
+	FBlueprintContextTracker::OnEnterScriptContext.Remove(OnEnterScriptContextHandle);
+	FBlueprintContextTracker::OnExitScriptContext.Remove(OnExitScriptContextHandle);
+#endif
+	bIsRecording = false;
+
+	if (Samples.Num() > 0 && FCommonValidatorsRuntimeSamples::MergeIntoFile(Samples))
+	{
+		UE_LOG(LogCommonValidators, Display, TEXT("Saved %d runtime samples to %s"), Samples.Num(), *FCommonValidatorsRuntimeSamples::GetSamplesFilename());
+	}
+
+	Samples.Reset();
+	TickSampleIndices.Reset();
+	OpenScriptContexts.Reset();
+}
+
+void FCommonValidatorsRuntimeSampler::OnSyncLoadPackage(const FString& PackageName)
+{
+#if DO_BLUEPRINT_GUARD
+	if (!IsInGameThread())
+	{
+		return;
+	}
+
+	const FBlueprintContextTracker* Tracker = FBlueprintContextTracker::TryGet();
+	if (!Tracker || Tracker->GetCurrentScriptStack().IsEmpty())
+	{
+		// Not triggered by blueprint script
+		return;
+	}
+
+	// The innermost script frame is the blueprint function that made the (possibly native) call which loaded
+	const FFrame& Frame = *Tracker->GetCurrentScriptStack().Last();
+	UFunction* Function = Frame.Node;
+	UBlueprint* Blueprint = Function ? UBlueprint::GetBlueprintFromClass(Cast<UBlueprintGeneratedClass>(Function->GetOuterUClass())) : nullptr;
+	if (!Blueprint || !Frame.Code)
+	{
+		return;
+	}
+
+	// Code already points past the opcode being executed
+	const int32 CodeOffset = UE_PTRDIFF_TO_INT32(Frame.Code - Function->Script.GetData()) - 1;
+	UEdGraphNode* Node = FKismetDebugUtilities::FindSourceNodeForCodeLocation(Frame.Object, Function, CodeOffset, /*bAllowImpreciseHit=*/true);
+	if (!Node)
+	{
+		return;
+	}
+
+	FCommonValidatorsRuntimeSample NewSample;
+	NewSample.Kind = ECommonValidatorsRuntimeSampleKind::SyncLoad;
+	NewSample.Blueprint = Blueprint->GetPathName();
+	NewSample.BlueprintSavedHash = FCommonValidatorsRuntimeSamples::GetSavedHash(*Blueprint);
+	NewSample.Graph = Node->GetGraph() ? Node->GetGraph()->GetFName() : Function->GetFName();
+	NewSample.Node = Node->NodeGuid;
+	NewSample.LoadedPackage = PackageName;
+	NewSample.Count = 1;
+
+	if (FCommonValidatorsRuntimeSample* Existing = Samples.FindByPredicate([&NewSample](const FCommonValidatorsRuntimeSample& Sample) { return Sample.HasSameKey(NewSample); }))
+	{
+		Existing->Accumulate(NewSample);
+	}
+	else
+	{
+		Samples.Add(MoveTemp(NewSample));
+	}
+#endif
+}
+
+void FCommonValidatorsRuntimeSampler::OnEnterScriptContext(const FBlueprintContextTracker& Tracker, const UObject* SourceObject, const UFunction* Function)
+{
+	if (IsInGameThread())
+	{
+		OpenScriptContexts.Add({ Function, FPlatformTime::Cycles64() });
+	}
+}
+
+void FCommonValidatorsRuntimeSampler::OnExitScriptContext(const FBlueprintContextTracker& Tracker)
+{
+	// Recording may have started while script was already running, ignore exits we never saw enter
+	if (!IsInGameThread() || OpenScriptContexts.IsEmpty())
+	{
+		return;
+	}
+
+	const FOpenScriptContext Context = OpenScriptContexts.Pop();
+	if (!Context.Function)
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<const UFunction> FunctionKey(Context.Function);
+	int32* SampleIndex = TickSampleIndices.Find(FunctionKey);
+	if (!SampleIndex)
+	{
+		static const FName EventTickName(TEXT("ReceiveTick"));
+
+		// First time this function is seen, work out once whether it's a blueprint tick event
+		int32 NewIndex = INDEX_NONE;
+		if (Context.Function->GetFName() == EventTickName)
+		{
+			if (const UBlueprint* Blueprint = UBlueprint::GetBlueprintFromClass(Cast<UBlueprintGeneratedClass>(Context.Function->GetOuterUClass())))
+			{
+				FCommonValidatorsRuntimeSample& NewSample = Samples.AddDefaulted_GetRef();
+				NewSample.Kind = ECommonValidatorsRuntimeSampleKind::Tick;
+				NewSample.Blueprint = Blueprint->GetPathName();
+				NewSample.BlueprintSavedHash = FCommonValidatorsRuntimeSamples::GetSavedHash(*Blueprint);
+				NewSample.Graph = Context.Function->GetFName();
+				NewIndex = Samples.Num() - 1;
+			}
+		}
+
+		SampleIndex = &TickSampleIndices.Add(FunctionKey, NewIndex);
+	}
+
+	if (*SampleIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const double Milliseconds = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Context.StartCycles);
+	FCommonValidatorsRuntimeSample& Sample = Samples[*SampleIndex];
+	++Sample.Count;
+	Sample.TotalMilliseconds += Milliseconds;
+	Sample.MaxMilliseconds = FMath::Max(Sample.MaxMilliseconds, Milliseconds);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "CommonValidatorsRuntimeSamples.h"
+
+struct FBlueprintContextTracker;
+
+/**
+ * Records what static validation can't see: synchronous package loads triggered from blueprint script
+ * (soft references resolved at runtime, loads hidden in native calls) and the time spent in blueprint tick events.
+ *
+ * Loads are attributed to the blueprint node on top of the script stack, ticks to the blueprint owning the tick event.
+ * Samples are aggregated in memory and merged into the samples file on Stop, where UEditorValidator_RuntimeSamples picks them up.
+ * Only script running on the game thread is recorded.
+ */
+class FCommonValidatorsRuntimeSampler
+{
+public:
+	static FCommonValidatorsRuntimeSampler& Get();
+
+	void Start();
+
+	// Stops recording and merges everything recorded since Start into the samples file
+	void Stop();
+
+	bool IsRecording() const { return bIsRecording; }
+
+private:
+	void OnSyncLoadPackage(const FString& PackageName);
+	void OnEnterScriptContext(const FBlueprintContextTracker& Tracker, const UObject* SourceObject, const UFunction* Function);
+	void OnExitScriptContext(const FBlueprintContextTracker& Tracker);
+
+	struct FOpenScriptContext
+	{
+		const UFunction* Function = nullptr;
+		uint64 StartCycles = 0;
+	};
+
+	// Script contexts nest (a tick can call into other blueprints), exits pop in reverse order
+	TArray<FOpenScriptContext> OpenScriptContexts;
+
+	TArray<FCommonValidatorsRuntimeSample> Samples;
+
+	// Tick events fire every frame for every instance, so their sample is found by function instead of by key.
+	// INDEX_NONE for functions that aren't blueprint tick events. Weak so a function recompiled during PIE
+	// that lands on the address of a destroyed one isn't attributed to the old blueprint.
+	TMap<TWeakObjectPtr<const UFunction>, int32> TickSampleIndices;
+
+	bool bIsRecording = false;
+
+	FDelegateHandle OnSyncLoadPackageHandle;
+	FDelegateHandle OnEnterScriptContextHandle;
+	FDelegateHandle OnExitScriptContextHandle;
+};
@@ -0,0 +1,56 @@
+#include "Modules/ModuleManager.h"
+#include "Editor.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "CommonValidatorsDeveloperSettings.h"
+#include "CommonValidatorsRuntimeSampler.h"
+
+class FCommonValidatorsRuntimeSamplerModule : public IModuleInterface
+{
+public:
+	virtual void StartupModule() override
+	{
+		// Automation runs record the whole session, e.g. -ExecCmds="Automation RunTests ..." -CommonValidatorsRuntimeSampler
+		if (FParse::Param(FCommandLine::Get(), TEXT("CommonValidatorsRuntimeSampler")))
+		{
+			FCommonValidatorsRuntimeSampler::Get().Start();
+		}
+
+		BeginPIEHandle = FEditorDelegates::BeginPIE.AddLambda([this](bool bIsSimulating)
+		{
+			FCommonValidatorsRuntimeSampler& Sampler = FCommonValidatorsRuntimeSampler::Get();
+			if (GetDefault<UCommonValidatorsDeveloperSettings>()->bRecordRuntimeSamplesInPIE && !Sampler.IsRecording())
+			{
+				Sampler.Start();
+				bStartedForPIE = Sampler.IsRecording();
+			}
+		});
+
+		// Recordings started from the command line or the console keep running until they are stopped the same way
+		EndPIEHandle = FEditorDelegates::EndPIE.AddLambda([this](bool bIsSimulating)
+		{
+			if (bStartedForPIE)
+			{
+				bStartedForPIE = false;
+				FCommonValidatorsRuntimeSampler::Get().Stop();
+			}
+		});
+	}
+
+	virtual void ShutdownModule() override
+	{
+		FEditorDelegates::BeginPIE.Remove(BeginPIEHandle);
+		FEditorDelegates::EndPIE.Remove(EndPIEHandle);
+
+		FCommonValidatorsRuntimeSampler::Get().Stop();
+	}
+
+private:
+	FDelegateHandle BeginPIEHandle;
+	FDelegateHandle EndPIEHandle;
+
+	// Only the recording BeginPIE started is stopped by EndPIE
+	bool bStartedForPIE = false;
+};
+
+IMPLEMENT_MODULE(FCommonValidatorsRuntimeSamplerModule, CommonValidatorsRuntimeSampler)